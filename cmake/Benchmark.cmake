@@ -0,0 +1,252 @@
+# Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Compile time benchmarks. The source file is compiled without generating code
+# and the time it takes is displayed. It is compiled once without extra macros
+# and once with each macro listed after the source file defined.
+macro(compile_time_benchmark TARGET_NAME SOURCE)
+  if(
+    CMAKE_COMPILER_IS_GNUCXX
+    OR "${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang"
+  )
+    separate_arguments(BENCHMARK_FLAGS UNIX_COMMAND "${CMAKE_CXX_FLAGS}")
+
+    set(
+      BENCHMARK_COMPILE
+      ${CMAKE_CXX_COMPILER} ${BENCHMARK_FLAGS}
+      -I${CMAKE_SOURCE_DIR} -I${Boost_INCLUDE_DIR}
+      -fsyntax-only ${CMAKE_CURRENT_SOURCE_DIR}/${SOURCE}
+    )
+
+    set(
+      BENCHMARK_COMMANDS
+      COMMAND ${CMAKE_COMMAND} -E echo "${SOURCE}"
+      COMMAND ${CMAKE_COMMAND} -E time ${BENCHMARK_COMPILE}
+    )
+    foreach(D ${ARGN})
+      set(
+        BENCHMARK_COMMANDS
+        ${BENCHMARK_COMMANDS}
+        COMMAND ${CMAKE_COMMAND} -E echo "${SOURCE} with ${D}"
+        COMMAND ${CMAKE_COMMAND} -E time ${BENCHMARK_COMPILE} -D${D}
+      )
+    endforeach(D)
+
+    add_custom_target(${TARGET_NAME} ${BENCHMARK_COMMANDS} VERBATIM)
+  else()
+    add_custom_target(
+      ${TARGET_NAME}
+      COMMAND ${CMAKE_COMMAND} -E echo "Benchmarks need GCC or Clang"
+    )
+  endif()
+endmacro(compile_time_benchmark)
+
+
+# Reports the size of the preprocessed form and the parse time of each header
+# in the INCLUDE_DIR directory (relative to the source root) when it is
+# included on its own.
+macro(header_cost_report TARGET_NAME INCLUDE_DIR)
+  if(
+    CMAKE_COMPILER_IS_GNUCXX
+    OR "${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang"
+  )
+    file(
+      GLOB HEADER_COST_HEADERS
+      RELATIVE ${CMAKE_SOURCE_DIR}
+      ${CMAKE_SOURCE_DIR}/${INCLUDE_DIR}/*.hpp
+    )
+
+    set(HEADER_COST_COMMANDS)
+    foreach(H ${HEADER_COST_HEADERS})
+      set(HEADER_COST_SOURCE ${CMAKE_CURRENT_BINARY_DIR}/${TARGET_NAME}/${H}.cpp)
+      file(WRITE ${HEADER_COST_SOURCE} "#include <${H}>\n")
+
+      set(
+        HEADER_COST_COMMANDS
+        ${HEADER_COST_COMMANDS}
+        COMMAND
+          ${CMAKE_COMMAND}
+          -DCXX=${CMAKE_CXX_COMPILER}
+          "-DCXX_FLAGS=${CMAKE_CXX_FLAGS} -I${CMAKE_SOURCE_DIR} -I${Boost_INCLUDE_DIR}"
+          -DSOURCE=${HEADER_COST_SOURCE}
+          -DHEADER=${H}
+          -P ${CMAKE_SOURCE_DIR}/cmake/HeaderCost.cmake
+      )
+    endforeach(H)
+
+    add_custom_target(${TARGET_NAME} ${HEADER_COST_COMMANDS} VERBATIM)
+  else()
+    add_custom_target(
+      ${TARGET_NAME}
+      COMMAND ${CMAKE_COMMAND} -E echo "Header cost reports need GCC or Clang"
+    )
+  endif()
+endmacro(header_cost_report)
+
+
+# Builds the unit tests from scratch in a separate build directory for each
+# configuration listed after the target name and displays the build times. The
+# format of the configurations is described in BuildBenchmark.cmake.
+macro(build_benchmark TARGET_NAME)
+  string(REPLACE ";" " " BUILD_BENCHMARK_CONFIGS "${ARGN}")
+  add_custom_target(
+    ${TARGET_NAME}
+    COMMAND
+      ${CMAKE_COMMAND}
+      -DSOURCE_DIR=${CMAKE_SOURCE_DIR}
+      -DBINARY_DIR=${CMAKE_BINARY_DIR}/${TARGET_NAME}
+      -DCXX=${CMAKE_CXX_COMPILER}
+      -DCXX_FLAGS=${CMAKE_CXX_FLAGS}
+      "-DTARGETS=metamonad_test metaparse_test safe_printf_test"
+      "-DCONFIGS=${BUILD_BENCHMARK_CONFIGS}"
+      -P ${CMAKE_SOURCE_DIR}/cmake/BuildBenchmark.cmake
+    VERBATIM
+  )
+endmacro(build_benchmark)
+
+
+# Sets VAR to the comma separated list of the character literals of TEXT
+function(grammar_profile_chars VAR TEXT)
+  set(CHARS)
+  string(LENGTH "${TEXT}" LEN)
+  set(I 0)
+  while(I LESS LEN)
+    string(SUBSTRING "${TEXT}" ${I} 1 C)
+    if(C STREQUAL "'" OR C STREQUAL "\\")
+      set(C "\\${C}")
+    endif()
+    if(CHARS)
+      set(CHARS "${CHARS}, '${C}'")
+    else()
+      set(CHARS "'${C}'")
+    endif()
+    math(EXPR I "${I} + 1")
+  endwhile()
+  set(${VAR} "${CHARS}" PARENT_SCOPE)
+endfunction(grammar_profile_chars)
+
+# Profiles the rules of a grammar built using metaparse::grammar. HEADER
+# (relative to the current source directory) defines the grammar and GRAMMAR
+# is the name of the grammar type. The arguments after the RULES keyword are
+# the names of the rules to profile, the arguments after the INPUTS keyword
+# are the sample inputs. Every rule is applied to every input in a separate
+# source file. The details of the report are described in GrammarProfile.cmake.
+macro(grammar_profile TARGET_NAME HEADER GRAMMAR)
+  if(
+    CMAKE_COMPILER_IS_GNUCXX
+    OR "${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang"
+  )
+    set(GRAMMAR_PROFILE_RULES)
+    set(GRAMMAR_PROFILE_INPUTS)
+    set(GRAMMAR_PROFILE_ARG)
+    foreach(A ${ARGN})
+      if(A STREQUAL "RULES" OR A STREQUAL "INPUTS")
+        set(GRAMMAR_PROFILE_ARG GRAMMAR_PROFILE_${A})
+      elseif(GRAMMAR_PROFILE_ARG)
+        list(APPEND ${GRAMMAR_PROFILE_ARG} "${A}")
+      endif()
+    endforeach(A)
+
+    set(GRAMMAR_PROFILE_DIR ${CMAKE_CURRENT_BINARY_DIR}/${TARGET_NAME})
+
+    # The generated sources are written using quoted arguments only, since
+    # the semicolons in them would separate the elements of a list
+    set(
+      GRAMMAR_PROFILE_PREFIX
+"#include \"${CMAKE_CURRENT_SOURCE_DIR}/${HEADER}\"
+
+#include <mpllibs/metaparse/v1/grammar.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/start.hpp>
+#include <mpllibs/metaparse/v1/string.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+
+#include <iostream>
+
+typedef ${GRAMMAR}::rules grammar_profile_rules;
+"
+    )
+    set(
+      GRAMMAR_PROFILE_TRACE
+"#ifdef MPLLIBS_METAPARSE_TRACE
+  std::cout
+    << mpllibs::metaparse::v1::impl::trace_log().size() << std::endl;
+#endif
+"
+    )
+
+    file(
+      WRITE ${GRAMMAR_PROFILE_DIR}/baseline.cpp
+"${GRAMMAR_PROFILE_PREFIX}
+int main()
+{
+${GRAMMAR_PROFILE_TRACE}}
+"
+    )
+
+    file(WRITE ${GRAMMAR_PROFILE_DIR}/profile.txt "")
+    foreach(R ${GRAMMAR_PROFILE_RULES})
+      grammar_profile_chars(GRAMMAR_PROFILE_RULE_CHARS "${R}")
+      set(GRAMMAR_PROFILE_INDEX 0)
+      foreach(I ${GRAMMAR_PROFILE_INPUTS})
+        grammar_profile_chars(GRAMMAR_PROFILE_INPUT_CHARS "${I}")
+        string(LENGTH "${I}" GRAMMAR_PROFILE_LENGTH)
+        set(GRAMMAR_PROFILE_SOURCE ${R}_${GRAMMAR_PROFILE_INDEX}.cpp)
+
+        file(
+          WRITE ${GRAMMAR_PROFILE_DIR}/${GRAMMAR_PROFILE_SOURCE}
+"${GRAMMAR_PROFILE_PREFIX}
+typedef
+  mpllibs::metaparse::v1::grammar_util::get_parser<
+    ${GRAMMAR},
+    mpllibs::metaparse::v1::grammar_util::rebuild<
+      mpllibs::metaparse::v1::string<${GRAMMAR_PROFILE_RULE_CHARS}>
+    >::type
+  >::type
+  grammar_profile_parser;
+
+typedef
+  boost::mpl::apply_wrap2<
+    grammar_profile_parser,
+    mpllibs::metaparse::v1::string<${GRAMMAR_PROFILE_INPUT_CHARS}>,
+    mpllibs::metaparse::v1::start
+  >::type
+  grammar_profile_result;
+
+int main()
+{
+${GRAMMAR_PROFILE_TRACE}  return
+    mpllibs::metaparse::v1::is_error<grammar_profile_result>::type::value;
+}
+"
+        )
+        file(
+          APPEND ${GRAMMAR_PROFILE_DIR}/profile.txt
+          "${GRAMMAR_PROFILE_SOURCE} ${R} ${GRAMMAR_PROFILE_LENGTH} ${I}\n"
+        )
+
+        math(EXPR GRAMMAR_PROFILE_INDEX "${GRAMMAR_PROFILE_INDEX} + 1")
+      endforeach(I)
+    endforeach(R)
+
+    add_custom_target(
+      ${TARGET_NAME}
+      COMMAND
+        ${CMAKE_COMMAND}
+        -DCXX=${CMAKE_CXX_COMPILER}
+        "-DCXX_FLAGS=${CMAKE_CXX_FLAGS} -I${CMAKE_SOURCE_DIR} -I${Boost_INCLUDE_DIR}"
+        -DDIR=${GRAMMAR_PROFILE_DIR}
+        -P ${CMAKE_SOURCE_DIR}/cmake/GrammarProfile.cmake
+      VERBATIM
+    )
+  else()
+    add_custom_target(
+      ${TARGET_NAME}
+      COMMAND ${CMAKE_COMMAND} -E echo "Grammar profiles need GCC or Clang"
+    )
+  endif()
+endmacro(grammar_profile)
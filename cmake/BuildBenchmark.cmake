@@ -0,0 +1,65 @@
+# Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Script mode helper of the build benchmark targets. It builds the targets
+# from scratch in a separate build directory for each configuration and
+# displays the time of each build.
+#
+# Arguments:
+#   SOURCE_DIR - the root of the source tree
+#   BINARY_DIR - the directory to create the build directories in
+#   CXX        - the compiler
+#   CXX_FLAGS  - the compiler flags separated by spaces
+#   TARGETS    - the targets to build separated by spaces
+#   CONFIGS    - the configurations separated by spaces. A configuration is
+#                a name optionally followed by a colon and the comma separated
+#                list of the options to enable, eg.
+#                pch:MPLLIBS_PRECOMPILED_HEADERS
+
+separate_arguments(TARGET_LIST UNIX_COMMAND "${TARGETS}")
+separate_arguments(CONFIG_LIST UNIX_COMMAND "${CONFIGS}")
+
+foreach(CONFIG ${CONFIG_LIST})
+  string(REGEX REPLACE ":.*$" "" NAME ${CONFIG})
+  set(OPTIONS)
+  if(CONFIG MATCHES ":")
+    string(REGEX REPLACE "^[^:]*:" "" OPTION_NAMES ${CONFIG})
+    string(REPLACE "," ";" OPTION_NAMES ${OPTION_NAMES})
+    foreach(O ${OPTION_NAMES})
+      set(OPTIONS ${OPTIONS} -D${O}=ON)
+    endforeach(O)
+  endif()
+
+  set(DIR ${BINARY_DIR}/${NAME})
+  file(REMOVE_RECURSE ${DIR})
+  file(MAKE_DIRECTORY ${DIR})
+  execute_process(
+    COMMAND
+      ${CMAKE_COMMAND}
+      -DCMAKE_CXX_COMPILER=${CXX}
+      -DCMAKE_CXX_FLAGS=${CXX_FLAGS}
+      ${OPTIONS}
+      ${SOURCE_DIR}
+    WORKING_DIRECTORY ${DIR}
+    OUTPUT_QUIET
+  )
+
+  string(TIMESTAMP START_TIME "%s")
+  foreach(T ${TARGET_LIST})
+    execute_process(
+      COMMAND ${CMAKE_COMMAND} --build . --target ${T}
+      WORKING_DIRECTORY ${DIR}
+      RESULT_VARIABLE BUILD_RESULT
+      OUTPUT_QUIET
+    )
+    if(NOT BUILD_RESULT EQUAL 0)
+      message(FATAL_ERROR "Building ${T} using ${NAME} failed")
+    endif()
+  endforeach(T)
+  string(TIMESTAMP END_TIME "%s")
+
+  math(EXPR BUILD_TIME "${END_TIME} - ${START_TIME}")
+  message("${NAME}: ${BUILD_TIME} s")
+endforeach(CONFIG)
@@ -0,0 +1,184 @@
+# Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Script mode helper of the grammar_profile macro. It compiles the source
+# building the grammar only (baseline.cpp) and the sources applying one rule
+# to one input (listed in profile.txt). For every rule and input it displays
+#
+#   - the time it takes to parse the source (needs CMake 3.23)
+#   - the GGC memory the compiler allocates (GCC only, from -ftime-report)
+#   - the number of parser applications the compiler instantiates, counted
+#     by building and running the source with MPLLIBS_METAPARSE_TRACE defined
+#   - whether the rule accepts the input
+#
+# The time is the absolute time of the fastest compilation of the source and
+# is displayed next to the one of the baseline. The compilations take a few
+# seconds and subtracting the baseline from them would leave the noise only.
+# The memory and the number of parser applications are deterministic, they are
+# displayed as the differences from the values of the baseline.
+#
+# Arguments:
+#   CXX        - the compiler
+#   CXX_FLAGS  - the compiler flags separated by spaces
+#   DIR        - the directory of the generated sources
+#   REPEAT     - the number of times to compile each source to measure the
+#                time (optional, 5 by default)
+
+separate_arguments(FLAGS UNIX_COMMAND "${CXX_FLAGS}")
+
+if(NOT REPEAT)
+  set(REPEAT 5)
+endif()
+
+# Sets the variables PROFILE_TIME (in ms), PROFILE_MEMORY (in kB),
+# PROFILE_APPLICATIONS and PROFILE_ACCEPTED to the values measured for SOURCE.
+# The variables are empty when the value is not available.
+macro(profile_source SOURCE)
+  set(PROFILE_TIME)
+  set(PROFILE_MEMORY)
+  set(PROFILE_APPLICATIONS)
+  set(PROFILE_ACCEPTED)
+
+  # The shortest of the REPEAT compilations is displayed to reduce the noise
+  set(RUN 0)
+  while(RUN LESS REPEAT)
+    string(TIMESTAMP START_TIME "%s%f")
+    execute_process(
+      COMMAND ${CXX} ${FLAGS} -fsyntax-only -ftime-report ${DIR}/${SOURCE}
+      RESULT_VARIABLE PARSE_RESULT
+      OUTPUT_QUIET
+      ERROR_VARIABLE TIME_REPORT
+    )
+    string(TIMESTAMP END_TIME "%s%f")
+
+    # Sub-second timestamps are available since CMake 3.23
+    if(PARSE_RESULT EQUAL 0 AND NOT CMAKE_VERSION VERSION_LESS 3.23)
+      math(EXPR RUN_TIME "(${END_TIME} - ${START_TIME}) / 1000")
+      if("${PROFILE_TIME}" STREQUAL "" OR RUN_TIME LESS PROFILE_TIME)
+        set(PROFILE_TIME ${RUN_TIME})
+      endif()
+    endif()
+    math(EXPR RUN "${RUN} + 1")
+  endwhile()
+
+  if(PARSE_RESULT EQUAL 0)
+    if(TIME_REPORT MATCHES "TOTAL[^\n]* ([0-9]+)([kM])")
+      set(PROFILE_MEMORY ${CMAKE_MATCH_1})
+      if(CMAKE_MATCH_2 STREQUAL "M")
+        math(EXPR PROFILE_MEMORY "${PROFILE_MEMORY} * 1024")
+      endif()
+    endif()
+
+    execute_process(
+      COMMAND
+        ${CXX} ${FLAGS} -DMPLLIBS_METAPARSE_TRACE
+        -o ${DIR}/${SOURCE}.trace ${DIR}/${SOURCE}
+      RESULT_VARIABLE BUILD_RESULT
+      OUTPUT_QUIET
+      ERROR_QUIET
+    )
+    if(BUILD_RESULT EQUAL 0)
+      execute_process(
+        COMMAND ${DIR}/${SOURCE}.trace
+        RESULT_VARIABLE RUN_RESULT
+        OUTPUT_VARIABLE RUN_OUTPUT
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+      )
+      set(PROFILE_APPLICATIONS ${RUN_OUTPUT})
+      if(RUN_RESULT EQUAL 0)
+        set(PROFILE_ACCEPTED accepted)
+      else()
+        set(PROFILE_ACCEPTED rejected)
+      endif()
+    endif()
+  endif()
+endmacro(profile_source)
+
+# Sets VAR to VALUE - BASE or to ? when one of them is not available. A rule
+# can not cost less than building the grammar, thus the difference is at least
+# 0.
+macro(profile_difference VAR VALUE BASE)
+  if("${VALUE}" STREQUAL "" OR "${BASE}" STREQUAL "")
+    set(${VAR} "?")
+  elseif(VALUE LESS BASE)
+    set(${VAR} 0)
+  else()
+    math(EXPR ${VAR} "${VALUE} - ${BASE}")
+  endif()
+endmacro(profile_difference)
+
+# Sets VAR to VALUE or to ? when it is not available
+macro(profile_value VAR VALUE)
+  if("${VALUE}" STREQUAL "")
+    set(${VAR} "?")
+  else()
+    set(${VAR} ${VALUE})
+  endif()
+endmacro(profile_value)
+
+# Sets VAR to VALUE padded to WIDTH characters
+macro(profile_pad VAR VALUE WIDTH)
+  set(${VAR} "${VALUE}")
+  string(LENGTH "${${VAR}}" PAD_LENGTH)
+  while(PAD_LENGTH LESS ${WIDTH})
+    set(${VAR} " ${${VAR}}")
+    math(EXPR PAD_LENGTH "${PAD_LENGTH} + 1")
+  endwhile()
+endmacro(profile_pad)
+
+profile_source(baseline.cpp)
+if("${PROFILE_APPLICATIONS}" STREQUAL "")
+  message(FATAL_ERROR "The grammar does not compile")
+endif()
+set(BASE_TIME ${PROFILE_TIME})
+set(BASE_MEMORY ${PROFILE_MEMORY})
+set(BASE_APPLICATIONS ${PROFILE_APPLICATIONS})
+
+profile_value(SHOWN_TIME "${BASE_TIME}")
+profile_value(SHOWN_MEMORY "${BASE_MEMORY}")
+message(
+  "Building the grammar: ${SHOWN_TIME} ms, ${SHOWN_MEMORY} kB, "
+  "${BASE_APPLICATIONS} parser applications"
+)
+message("")
+message(
+  "                rule  length  time (ms) / grammar  memory (kB)  applications"
+  "  input"
+)
+
+file(STRINGS ${DIR}/profile.txt PROFILE_LINES)
+foreach(L ${PROFILE_LINES})
+  # The format of the lines is "<source> <rule> <input length> <input>"
+  string(REGEX MATCH "^([^ ]*) ([^ ]*) ([^ ]*) (.*)$" L "${L}")
+  set(SOURCE ${CMAKE_MATCH_1})
+  set(RULE ${CMAKE_MATCH_2})
+  set(LENGTH ${CMAKE_MATCH_3})
+  set(INPUT "${CMAKE_MATCH_4}")
+
+  profile_source(${SOURCE})
+  if("${PROFILE_APPLICATIONS}" STREQUAL "")
+    profile_pad(RULE "${RULE}" 20)
+    message("${RULE}  does not compile with input \"${INPUT}\"")
+  else()
+    profile_value(TIME "${PROFILE_TIME}")
+    profile_difference(MEMORY "${PROFILE_MEMORY}" "${BASE_MEMORY}")
+    profile_difference(
+      APPLICATIONS
+      "${PROFILE_APPLICATIONS}"
+      "${BASE_APPLICATIONS}"
+    )
+
+    profile_pad(RULE "${RULE}" 20)
+    profile_pad(LENGTH "${LENGTH}" 8)
+    profile_pad(TIME "${TIME}" 11)
+    profile_pad(GRAMMAR_TIME "${SHOWN_TIME}" 8)
+    profile_pad(MEMORY "${MEMORY}" 13)
+    profile_pad(APPLICATIONS "${APPLICATIONS}" 14)
+    message(
+      "${RULE}${LENGTH}${TIME} /${GRAMMAR_TIME}${MEMORY}${APPLICATIONS}  "
+      "\"${INPUT}\" (${PROFILE_ACCEPTED})"
+    )
+  endif()
+endforeach(L)
@@ -0,0 +1,51 @@
+# Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Script mode helper of the header_cost_report macro. It displays the size of
+# the preprocessed form of a header and the time it takes to parse it.
+#
+# Arguments:
+#   CXX        - the compiler
+#   CXX_FLAGS  - the compiler flags separated by spaces
+#   SOURCE     - a source file including the header only
+#   HEADER     - the name of the header to display
+
+separate_arguments(FLAGS UNIX_COMMAND "${CXX_FLAGS}")
+
+execute_process(
+  COMMAND ${CXX} ${FLAGS} -E ${SOURCE}
+  OUTPUT_VARIABLE PREPROCESSED
+  ERROR_QUIET
+)
+string(LENGTH "${PREPROCESSED}" PREPROCESSED_SIZE)
+
+# Sub-second timestamps are available since CMake 3.23
+if(NOT CMAKE_VERSION VERSION_LESS 3.23)
+  string(TIMESTAMP START_TIME "%s%f")
+  execute_process(
+    COMMAND ${CXX} ${FLAGS} -fsyntax-only ${SOURCE}
+    RESULT_VARIABLE PARSE_RESULT
+    OUTPUT_QUIET
+    ERROR_QUIET
+  )
+  string(TIMESTAMP END_TIME "%s%f")
+  math(EXPR PARSE_TIME "(${END_TIME} - ${START_TIME}) / 1000")
+  set(PARSE_TIME "${PARSE_TIME} ms")
+else()
+  execute_process(
+    COMMAND ${CXX} ${FLAGS} -fsyntax-only ${SOURCE}
+    RESULT_VARIABLE PARSE_RESULT
+    OUTPUT_QUIET
+    ERROR_QUIET
+  )
+  set(PARSE_TIME "unknown (needs CMake 3.23)")
+endif()
+
+if(PARSE_RESULT EQUAL 0)
+  message("${HEADER}: ${PREPROCESSED_SIZE} bytes, parsed in ${PARSE_TIME}")
+else()
+  message("${HEADER}: does not compile on its own")
+endif()
+
@@ -0,0 +1,208 @@
+# Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# C++20 header units of the public headers of the libraries. The interface of
+# the libraries contains macros (MPLLIBS_STRING, the MPLLIBS_LIMIT_* macros,
+# etc) which can not be exported from named modules, but header units export
+# them. When MPLLIBS_HEADER_UNITS is enabled, every public header is
+# precompiled into a header unit and the targets using them import them.
+#
+# With GCC the #include directives of the targets are translated into imports
+# by the compiler based on a module mapper. Clang translates #include
+# directives into imports in the global module fragment only, therefore the
+# targets are given a header including nothing but the import declarations of
+# every header unit. The include guards exported by the header units turn the
+# #include directives of the sources into no-ops. The sources compiled with
+# textual inclusion define MPLLIBS_HEADER_UNITS_TEXTUAL to skip the imports.
+#
+# Header units are compiled independently of the translation units importing
+# them, thus the sources defining configuration macros before including an
+# mpllibs header have to be compiled with textual inclusion.
+
+option(
+  MPLLIBS_HEADER_UNITS
+  "Import the public headers as C++20 header units (GCC 11 or Clang 16)"
+  OFF
+)
+
+set(HEADER_UNIT_DIR ${CMAKE_BINARY_DIR}/header_units)
+
+# The template template parameters of let_impl's specialisations rely on the
+# pre-C++17 matching rules
+if("${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang")
+  set(HEADER_UNIT_CLANG ON)
+  set(HEADER_UNIT_FLAGS "-std=c++20 -fno-relaxed-template-template-args")
+else()
+  set(HEADER_UNIT_CLANG OFF)
+  set(HEADER_UNIT_FLAGS "-std=c++20 -fmodules-ts -fno-new-ttp-matching")
+endif()
+
+if(MPLLIBS_HEADER_UNITS)
+  if(
+    NOT (
+      (
+        CMAKE_COMPILER_IS_GNUCXX
+        AND NOT CMAKE_CXX_COMPILER_VERSION VERSION_LESS 11
+      )
+      OR (
+        HEADER_UNIT_CLANG
+        AND NOT CMAKE_CXX_COMPILER_VERSION VERSION_LESS 16
+      )
+    )
+  )
+    message(
+      WARNING
+      "MPLLIBS_HEADER_UNITS needs GCC 11 or Clang 16 or newer, using textual"
+      " inclusion"
+    )
+    set(MPLLIBS_HEADER_UNITS OFF CACHE BOOL "" FORCE)
+  endif()
+endif()
+
+if(MPLLIBS_HEADER_UNITS)
+
+  file(
+    GLOB HEADER_UNIT_HEADERS
+    RELATIVE ${CMAKE_SOURCE_DIR}
+    ${CMAKE_SOURCE_DIR}/mpllibs/metamonad/*.hpp
+    ${CMAKE_SOURCE_DIR}/mpllibs/metaparse/*.hpp
+    ${CMAKE_SOURCE_DIR}/mpllibs/metaparse/cx/*.hpp
+    ${CMAKE_SOURCE_DIR}/mpllibs/metaparse/error/*.hpp
+    ${CMAKE_SOURCE_DIR}/mpllibs/metaparse/util/*.hpp
+    ${CMAKE_SOURCE_DIR}/mpllibs/safe_printf/*.hpp
+  )
+
+  separate_arguments(
+    HEADER_UNIT_COMPILE
+    UNIX_COMMAND
+    "${CMAKE_CXX_FLAGS} ${HEADER_UNIT_FLAGS}"
+  )
+
+  if(HEADER_UNIT_CLANG)
+    # Every header unit is built from its header including the other public
+    # headers textually, Clang merges their declarations when a translation
+    # unit imports more than one of them.
+    set(HEADER_UNIT_IMPORTS ${HEADER_UNIT_DIR}/imports.hpp)
+    set(HEADER_UNIT_IMPORT_LIST "#ifndef MPLLIBS_HEADER_UNITS_TEXTUAL\n")
+    set(HEADER_UNIT_IMPORT_FLAGS "-include ${HEADER_UNIT_IMPORTS}")
+    set(HEADER_UNIT_TEXTUAL_FLAGS "-DMPLLIBS_HEADER_UNITS_TEXTUAL")
+    set(HEADER_UNIT_CMIS)
+    foreach(H ${HEADER_UNIT_HEADERS})
+      string(REGEX REPLACE "\\.hpp$" "" H_BASE ${H})
+      set(H_CMI ${HEADER_UNIT_DIR}/${H_BASE}.pcm)
+      set(
+        HEADER_UNIT_IMPORT_LIST
+        "${HEADER_UNIT_IMPORT_LIST}import <${H}>;\n"
+      )
+      set(
+        HEADER_UNIT_IMPORT_FLAGS
+        "${HEADER_UNIT_IMPORT_FLAGS} -fmodule-file=${H_CMI}"
+      )
+
+      get_filename_component(H_DIR ${H_CMI} PATH)
+      file(MAKE_DIRECTORY ${H_DIR})
+
+      add_custom_command(
+        OUTPUT ${H_CMI}
+        COMMAND
+          ${CMAKE_CXX_COMPILER} ${HEADER_UNIT_COMPILE}
+          -I${CMAKE_SOURCE_DIR} -I${Boost_INCLUDE_DIR}
+          -fmodule-header=user -xc++-user-header ${CMAKE_SOURCE_DIR}/${H}
+          -o ${H_CMI}
+        DEPENDS ${CMAKE_SOURCE_DIR}/${H}
+        IMPLICIT_DEPENDS CXX ${CMAKE_SOURCE_DIR}/${H}
+        WORKING_DIRECTORY ${HEADER_UNIT_DIR}
+        VERBATIM
+      )
+      set(HEADER_UNIT_CMIS ${HEADER_UNIT_CMIS} ${H_CMI})
+    endforeach(H)
+
+    file(WRITE ${HEADER_UNIT_IMPORTS} "${HEADER_UNIT_IMPORT_LIST}#endif\n")
+  else()
+    # The module mapper of the importing translation units lists every
+    # header unit. Each header unit is built using a mapper listing only
+    # itself to avoid translating the includes of the other public headers
+    # while the header units are being built.
+    set(HEADER_UNIT_MAPPER ${HEADER_UNIT_DIR}/mapper)
+    set(HEADER_UNIT_TEXTUAL_MAPPER ${HEADER_UNIT_DIR}/textual_mapper)
+    set(HEADER_UNIT_IMPORT_FLAGS "-fmodule-mapper=${HEADER_UNIT_MAPPER}")
+    set(
+      HEADER_UNIT_TEXTUAL_FLAGS
+      "-fmodule-mapper=${HEADER_UNIT_TEXTUAL_MAPPER}"
+    )
+
+    file(WRITE ${HEADER_UNIT_TEXTUAL_MAPPER} "$root ${HEADER_UNIT_DIR}\n")
+
+    set(HEADER_UNIT_MAP "$root ${HEADER_UNIT_DIR}\n")
+    set(HEADER_UNIT_CMIS)
+    foreach(H ${HEADER_UNIT_HEADERS})
+      string(REGEX REPLACE "\\.hpp$" "" H_BASE ${H})
+      set(H_ENTRY "${CMAKE_SOURCE_DIR}/${H} ${H_BASE}.gcm\n")
+      set(HEADER_UNIT_MAP "${HEADER_UNIT_MAP}${H_ENTRY}")
+
+      file(
+        WRITE ${HEADER_UNIT_DIR}/${H_BASE}.map
+        "$root ${HEADER_UNIT_DIR}\n${H_ENTRY}"
+      )
+
+      add_custom_command(
+        OUTPUT ${HEADER_UNIT_DIR}/${H_BASE}.gcm
+        COMMAND
+          ${CMAKE_CXX_COMPILER} ${HEADER_UNIT_COMPILE}
+          -fmodule-mapper=${HEADER_UNIT_DIR}/${H_BASE}.map
+          -I${CMAKE_SOURCE_DIR} -I${Boost_INCLUDE_DIR}
+          -fmodule-header=user -x c++-header ${H}
+        DEPENDS ${CMAKE_SOURCE_DIR}/${H}
+        IMPLICIT_DEPENDS CXX ${CMAKE_SOURCE_DIR}/${H}
+        WORKING_DIRECTORY ${HEADER_UNIT_DIR}
+        VERBATIM
+      )
+      set(
+        HEADER_UNIT_CMIS
+        ${HEADER_UNIT_CMIS} ${HEADER_UNIT_DIR}/${H_BASE}.gcm
+      )
+    endforeach(H)
+
+    file(WRITE ${HEADER_UNIT_MAPPER} "${HEADER_UNIT_MAP}")
+  endif()
+
+  add_custom_target(header_units DEPENDS ${HEADER_UNIT_CMIS})
+endif()
+
+# Makes TARGET_NAME import the header units when MPLLIBS_HEADER_UNITS is
+# enabled. The sources listed after the target name are compiled with textual
+# inclusion.
+macro(use_header_units TARGET_NAME)
+  if(MPLLIBS_HEADER_UNITS)
+    set_property(
+      TARGET ${TARGET_NAME}
+      APPEND_STRING PROPERTY
+      COMPILE_FLAGS " ${HEADER_UNIT_FLAGS} ${HEADER_UNIT_IMPORT_FLAGS}"
+    )
+    add_dependencies(${TARGET_NAME} header_units)
+
+    foreach(S ${ARGN})
+      set_property(
+        SOURCE ${CMAKE_CURRENT_SOURCE_DIR}/${S}
+        APPEND_STRING PROPERTY
+        COMPILE_FLAGS " ${HEADER_UNIT_TEXTUAL_FLAGS}"
+      )
+    endforeach(S)
+  endif()
+endmacro(use_header_units)
+
+# Compares the time it takes to build the unit tests from scratch using
+# textual inclusion and using the header units (including the time it takes to
+# build the header units)
+if(
+  CMAKE_COMPILER_IS_GNUCXX
+  OR "${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang"
+)
+  build_benchmark(
+    header_units_benchmark
+    headers
+    header_units:MPLLIBS_HEADER_UNITS
+  )
+endif()
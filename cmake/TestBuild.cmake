@@ -0,0 +1,111 @@
+# Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Options to speed up building the unit tests. Every source file of a unit
+# test includes Boost.Test and the common headers of the test suite. With
+# MPLLIBS_PRECOMPILED_HEADERS they are parsed once for the whole test suite.
+# With MPLLIBS_UNITY_BUILD the source files are compiled in batches of
+# MPLLIBS_UNITY_BUILD_BATCH_SIZE files, thus the headers are parsed and the
+# common templates are instantiated once for each batch.
+#
+# Both options need CMake 3.16 or newer.
+
+if(NOT CMAKE_VERSION VERSION_LESS 3.16)
+  option(
+    MPLLIBS_PRECOMPILED_HEADERS
+    "Use precompiled headers to build the unit tests"
+    OFF
+  )
+  option(MPLLIBS_UNITY_BUILD "Use unity builds for the unit tests" OFF)
+  set(
+    MPLLIBS_UNITY_BUILD_BATCH_SIZE 16
+    CACHE STRING "The number of source files compiled together"
+  )
+endif()
+
+include(CMakeParseArguments)
+
+# speed_up_build(
+#   TARGET_NAME
+#   PRECOMPILE <headers>
+#   ISOLATE <sources>
+#   SEPARATE <sources>
+# )
+#
+# Applies the above options to TARGET_NAME. The PRECOMPILE headers are
+# relative to the current source directory, system headers are given in angle
+# brackets. The ISOLATE sources are compiled on their own and without the
+# precompiled headers: these are the ones defining macros before including a
+# header. The SEPARATE sources are compiled on their own in unity builds: these
+# are the ones defining the same helpers as other sources of the target.
+macro(speed_up_build TARGET_NAME)
+  cmake_parse_arguments(
+    SPEED_UP
+    ""
+    ""
+    "PRECOMPILE;ISOLATE;SEPARATE"
+    ${ARGN}
+  )
+
+  if(MPLLIBS_PRECOMPILED_HEADERS)
+    set(SPEED_UP_HEADERS)
+    foreach(H ${SPEED_UP_PRECOMPILE})
+      if(H MATCHES "^<")
+        set(SPEED_UP_HEADERS ${SPEED_UP_HEADERS} ${H})
+      else()
+        set(
+          SPEED_UP_HEADERS
+          ${SPEED_UP_HEADERS}
+          ${CMAKE_CURRENT_SOURCE_DIR}/${H}
+        )
+      endif()
+    endforeach(H)
+    target_precompile_headers(${TARGET_NAME} PRIVATE ${SPEED_UP_HEADERS})
+
+    foreach(S ${SPEED_UP_ISOLATE})
+      set_property(
+        SOURCE ${CMAKE_CURRENT_SOURCE_DIR}/${S}
+        PROPERTY SKIP_PRECOMPILE_HEADERS ON
+      )
+    endforeach(S)
+  endif()
+
+  if(MPLLIBS_UNITY_BUILD)
+    set_target_properties(
+      ${TARGET_NAME}
+      PROPERTIES
+        UNITY_BUILD ON
+        UNITY_BUILD_BATCH_SIZE ${MPLLIBS_UNITY_BUILD_BATCH_SIZE}
+    )
+
+    # The sources are included into the unity source, thus GCC warns about
+    # the templates instantiated with the classes of their unnamed namespaces
+    if(CMAKE_COMPILER_IS_GNUCXX)
+      set_property(
+        TARGET ${TARGET_NAME}
+        APPEND PROPERTY COMPILE_OPTIONS -Wno-subobject-linkage
+      )
+    endif()
+
+    foreach(S ${SPEED_UP_ISOLATE} ${SPEED_UP_SEPARATE})
+      set_property(
+        SOURCE ${CMAKE_CURRENT_SOURCE_DIR}/${S}
+        PROPERTY SKIP_UNITY_BUILD_INCLUSION ON
+      )
+    endforeach(S)
+  endif()
+endmacro(speed_up_build)
+
+# Compares the time it takes to build the unit tests from scratch using the
+# above options
+if(NOT CMAKE_VERSION VERSION_LESS 3.16)
+  build_benchmark(
+    test_build_benchmark
+    default
+    pch:MPLLIBS_PRECOMPILED_HEADERS
+    unity:MPLLIBS_UNITY_BUILD
+    pch_unity:MPLLIBS_PRECOMPILED_HEADERS,MPLLIBS_UNITY_BUILD
+  )
+endif()
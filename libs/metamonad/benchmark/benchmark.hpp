@@ -0,0 +1,33 @@
+#ifndef MPLLIBS_METAMONAD_BENCHMARK_BENCHMARK_HPP
+#define MPLLIBS_METAMONAD_BENCHMARK_BENCHMARK_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+#ifndef MPLLIBS_BENCHMARK_SIZE
+#  define MPLLIBS_BENCHMARK_SIZE 200
+#endif
+
+// The benchmark is expected to define MPLLIBS_BENCHMARK_CALL(n), a
+// metafunction call using n. MPLLIBS_BENCHMARK evaluates it for
+// n = 0 .. MPLLIBS_BENCHMARK_SIZE - 1
+
+#ifdef MPLLIBS_BENCHMARK_STEP
+#  error MPLLIBS_BENCHMARK_STEP already defined
+#endif
+#define MPLLIBS_BENCHMARK_STEP(z, n, unused) \
+  typedef MPLLIBS_BENCHMARK_CALL(n)::type BOOST_PP_CAT(benchmark_result, n);
+
+#ifdef MPLLIBS_BENCHMARK
+#  error MPLLIBS_BENCHMARK already defined
+#endif
+#define MPLLIBS_BENCHMARK \
+  BOOST_PP_REPEAT(MPLLIBS_BENCHMARK_SIZE, MPLLIBS_BENCHMARK_STEP, ~)
+
+#endif
+
@@ -0,0 +1,77 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/either.hpp>
+#include <mpllibs/metamonad/bind.hpp>
+#include <mpllibs/metamonad/tmp_value.hpp>
+
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/next.hpp>
+
+#include "benchmark.hpp"
+
+using mpllibs::metamonad::bind;
+using mpllibs::metamonad::right;
+using mpllibs::metamonad::tmp_value;
+
+#ifdef MPLLIBS_BENCHMARK_LAMBDA_INSTANCE
+
+#include <mpllibs/metamonad/lambda_c.hpp>
+#include <mpllibs/metamonad/eval_case.hpp>
+#include <mpllibs/metamonad/matches_c.hpp>
+#include <mpllibs/metamonad/apply.hpp>
+#include <mpllibs/metamonad/name.hpp>
+
+namespace
+{
+  struct benchmark_tag;
+}
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      template <>
+      struct monad<benchmark_tag> : monad_defaults<benchmark_tag>
+      {
+        typedef right<> return_;
+
+        typedef
+          lambda_c<a, f,
+            eval_case< a,
+              matches_c<left<_>,  a>,
+              matches_c<right<x>, apply<f, x> >
+            >
+          >
+          bind;
+      };
+    }
+  }
+}
+
+#else
+
+typedef mpllibs::metamonad::either_tag<> benchmark_tag;
+
+#endif
+
+namespace
+{
+  struct next_right : tmp_value<next_right>
+  {
+    template <class N>
+    struct apply : right<boost::mpl::next<N> > {};
+  };
+}
+
+#define MPLLIBS_BENCHMARK_CALL(n) \
+  bind<benchmark_tag, right<boost::mpl::int_<n> >, next_right>
+
+MPLLIBS_BENCHMARK
+
+int main() {}
+
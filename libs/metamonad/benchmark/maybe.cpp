@@ -0,0 +1,77 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/maybe.hpp>
+#include <mpllibs/metamonad/bind.hpp>
+#include <mpllibs/metamonad/tmp_value.hpp>
+
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/next.hpp>
+
+#include "benchmark.hpp"
+
+using mpllibs::metamonad::bind;
+using mpllibs::metamonad::just;
+using mpllibs::metamonad::tmp_value;
+
+#ifdef MPLLIBS_BENCHMARK_LAMBDA_INSTANCE
+
+#include <mpllibs/metamonad/lambda_c.hpp>
+#include <mpllibs/metamonad/eval_case.hpp>
+#include <mpllibs/metamonad/matches_c.hpp>
+#include <mpllibs/metamonad/apply.hpp>
+#include <mpllibs/metamonad/name.hpp>
+
+namespace
+{
+  struct benchmark_tag;
+}
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      template <>
+      struct monad<benchmark_tag> : monad_defaults<benchmark_tag>
+      {
+        typedef just<> return_;
+
+        typedef
+          lambda_c<a, f,
+            eval_case< a,
+              matches_c<nothing, a>,
+              matches_c<just<x>, apply<f, x> >
+            >
+          >
+          bind;
+      };
+    }
+  }
+}
+
+#else
+
+typedef mpllibs::metamonad::maybe_tag<> benchmark_tag;
+
+#endif
+
+namespace
+{
+  struct next_just : tmp_value<next_just>
+  {
+    template <class N>
+    struct apply : just<boost::mpl::next<N> > {};
+  };
+}
+
+#define MPLLIBS_BENCHMARK_CALL(n) \
+  bind<benchmark_tag, just<boost::mpl::int_<n> >, next_just>
+
+MPLLIBS_BENCHMARK
+
+int main() {}
+
@@ -0,0 +1,83 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/reader.hpp>
+#include <mpllibs/metamonad/bind.hpp>
+#include <mpllibs/metamonad/return_.hpp>
+#include <mpllibs/metamonad/apply.hpp>
+#include <mpllibs/metamonad/tmp_value.hpp>
+
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/next.hpp>
+
+#include "benchmark.hpp"
+
+using mpllibs::metamonad::bind;
+using mpllibs::metamonad::return_;
+using mpllibs::metamonad::apply;
+using mpllibs::metamonad::tmp_value;
+
+#ifdef MPLLIBS_BENCHMARK_LAMBDA_INSTANCE
+
+#include <mpllibs/metamonad/lambda_c.hpp>
+#include <mpllibs/metamonad/name.hpp>
+
+namespace
+{
+  struct benchmark_tag;
+}
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      template <>
+      struct monad<benchmark_tag> : monad_defaults<benchmark_tag>
+      {
+        typedef lambda_c<t, _, t> return_;
+        typedef lambda_c<a, f, r, apply<apply<f, apply<a, r> >, r> > bind;
+      };
+    }
+  }
+}
+
+#else
+
+typedef mpllibs::metamonad::reader_tag benchmark_tag;
+
+#endif
+
+namespace
+{
+  template <class N>
+  struct next_value : tmp_value<next_value<N> >
+  {
+    template <class R>
+    struct apply : boost::mpl::next<N> {};
+  };
+
+  struct next_reader : tmp_value<next_reader>
+  {
+    template <class N>
+    struct apply : next_value<N> {};
+  };
+}
+
+#define MPLLIBS_BENCHMARK_CALL(n) \
+  apply< \
+    bind< \
+      benchmark_tag, \
+      return_<benchmark_tag, boost::mpl::int_<n> >, \
+      next_reader \
+    >, \
+    boost::mpl::int_<0> \
+  >
+
+MPLLIBS_BENCHMARK
+
+int main() {}
+
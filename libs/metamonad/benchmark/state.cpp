@@ -0,0 +1,84 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/state.hpp>
+#include <mpllibs/metamonad/bind.hpp>
+#include <mpllibs/metamonad/return_.hpp>
+#include <mpllibs/metamonad/apply.hpp>
+#include <mpllibs/metamonad/pair.hpp>
+#include <mpllibs/metamonad/tmp_value.hpp>
+
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/next.hpp>
+
+#include "benchmark.hpp"
+
+using mpllibs::metamonad::bind;
+using mpllibs::metamonad::return_;
+using mpllibs::metamonad::apply;
+using mpllibs::metamonad::pair;
+using mpllibs::metamonad::tmp_value;
+
+#ifdef MPLLIBS_BENCHMARK_LAMBDA_INSTANCE
+
+#include <mpllibs/metamonad/lambda_c.hpp>
+#include <mpllibs/metamonad/eval_match_let_c.hpp>
+#include <mpllibs/metamonad/name.hpp>
+
+namespace
+{
+  struct benchmark_tag;
+}
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      template <>
+      struct monad<benchmark_tag> : monad_defaults<benchmark_tag>
+      {
+        typedef pair<> return_;
+
+        typedef
+          lambda_c<a, f, s,
+            eval_match_let_c<pair<t, u>, apply<a, s>, apply<apply<f, t>, u> >
+          >
+          bind;
+      };
+    }
+  }
+}
+
+#else
+
+typedef mpllibs::metamonad::state_tag benchmark_tag;
+
+#endif
+
+namespace
+{
+  struct next_state : tmp_value<next_state>
+  {
+    template <class N>
+    struct apply : pair<boost::mpl::next<N> > {};
+  };
+}
+
+#define MPLLIBS_BENCHMARK_CALL(n) \
+  apply< \
+    bind< \
+      benchmark_tag, \
+      return_<benchmark_tag, boost::mpl::int_<n> >, \
+      next_state \
+    >, \
+    boost::mpl::int_<0> \
+  >
+
+MPLLIBS_BENCHMARK
+
+int main() {}
+
@@ -0,0 +1,85 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/writer.hpp>
+#include <mpllibs/metamonad/list.hpp>
+#include <mpllibs/metamonad/bind.hpp>
+#include <mpllibs/metamonad/return_.hpp>
+#include <mpllibs/metamonad/pair.hpp>
+#include <mpllibs/metamonad/tmp_value.hpp>
+
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/next.hpp>
+#include <boost/mpl/list.hpp>
+
+#include "benchmark.hpp"
+
+using mpllibs::metamonad::bind;
+using mpllibs::metamonad::return_;
+using mpllibs::metamonad::pair;
+using mpllibs::metamonad::tmp_value;
+using mpllibs::metamonad::list_tag;
+
+#ifdef MPLLIBS_BENCHMARK_LAMBDA_INSTANCE
+
+#include <mpllibs/metamonad/lambda_c.hpp>
+#include <mpllibs/metamonad/mappend.hpp>
+#include <mpllibs/metamonad/mempty.hpp>
+#include <mpllibs/metamonad/first.hpp>
+#include <mpllibs/metamonad/second.hpp>
+#include <mpllibs/metamonad/apply.hpp>
+#include <mpllibs/metamonad/name.hpp>
+
+namespace
+{
+  struct benchmark_tag;
+}
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      template <>
+      struct monad<benchmark_tag> : monad_defaults<benchmark_tag>
+      {
+        typedef lambda_c<t, pair<t, mempty<list_tag> > > return_;
+
+        typedef
+          lambda_c<a, f,
+            pair<
+              first<apply<f, first<a> > >,
+              mappend<list_tag, second<a>, second<apply<f, first<a> > > >
+            >
+          >
+          bind;
+      };
+    }
+  }
+}
+
+#else
+
+typedef mpllibs::metamonad::writer_tag<list_tag> benchmark_tag;
+
+#endif
+
+namespace
+{
+  struct log_next : tmp_value<log_next>
+  {
+    template <class N>
+    struct apply : pair<boost::mpl::next<N>, boost::mpl::list<N> > {};
+  };
+}
+
+#define MPLLIBS_BENCHMARK_CALL(n) \
+  bind<benchmark_tag, return_<benchmark_tag, boost::mpl::int_<n> >, log_next>
+
+MPLLIBS_BENCHMARK
+
+int main() {}
+
@@ -6,6 +6,7 @@
 // No include guards to make it possible to include it multiple times
 
 #include <mpllibs/metamonad/algebraic_data_type_tag.hpp>
+#include <mpllibs/metamonad/algebraic_data_type_tag_mpl.hpp>
 #include <mpllibs/metamonad/already_lazy.hpp>
 #include <mpllibs/metamonad/already_monadic.hpp>
 #include <mpllibs/metamonad/apply.hpp>
@@ -24,6 +25,10 @@
 #include <mpllibs/metamonad/concat.hpp>
 #include <mpllibs/metamonad/concat_map.hpp>
 #include <mpllibs/metamonad/data.hpp>
+#include <mpllibs/metamonad/dict_at.hpp>
+#include <mpllibs/metamonad/dict_has_key.hpp>
+#include <mpllibs/metamonad/dict.hpp>
+#include <mpllibs/metamonad/dict_insert.hpp>
 #include <mpllibs/metamonad/do_c.hpp>
 #include <mpllibs/metamonad/do_.hpp>
 #include <mpllibs/metamonad/do_return.hpp>
@@ -89,6 +94,7 @@
 #include <mpllibs/metamonad/match_let.hpp>
 #include <mpllibs/metamonad/maybe.hpp>
 #include <mpllibs/metamonad/mconcat.hpp>
+#include <mpllibs/metamonad/memo_metafunction.hpp>
 #include <mpllibs/metamonad/mempty.hpp>
 #include <mpllibs/metamonad/metafunction.hpp>
 #include <mpllibs/metamonad/monad.hpp>
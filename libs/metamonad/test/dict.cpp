@@ -0,0 +1,50 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/dict.hpp>
+#include <mpllibs/metamonad/dict_insert.hpp>
+#include <mpllibs/metamonad/dict_at.hpp>
+#include <mpllibs/metamonad/dict_has_key.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/assert.hpp>
+
+#include "common.hpp"
+
+BOOST_AUTO_TEST_CASE(test_dict)
+{
+  using mpllibs::metamonad::dict;
+  using mpllibs::metamonad::dict_insert;
+  using mpllibs::metamonad::dict_at;
+  using mpllibs::metamonad::dict_has_key;
+
+  using boost::mpl::equal_to;
+  using boost::mpl::not_;
+
+  typedef dict_insert<dict_insert<dict, int1, int11>, int2, int13> d12;
+
+  // test_empty_dict_has_no_key
+  BOOST_MPL_ASSERT((not_<dict_has_key<dict, int1> >));
+
+  // test_has_inserted_key
+  BOOST_MPL_ASSERT((dict_has_key<d12, int1>));
+  BOOST_MPL_ASSERT((dict_has_key<d12, int2>));
+
+  // test_has_no_other_key
+  BOOST_MPL_ASSERT((not_<dict_has_key<d12, int3> >));
+
+  // test_at
+  BOOST_MPL_ASSERT((equal_to<int11, dict_at<d12, int1>::type>));
+  BOOST_MPL_ASSERT((equal_to<int13, dict_at<d12, int2>::type>));
+
+  // test_reinserting_key_keeps_the_value
+  BOOST_MPL_ASSERT((
+    equal_to<int11, dict_at<dict_insert<d12, int1, int0>, int1>::type>
+  ));
+}
+
@@ -21,6 +21,12 @@
 
 #include "common.hpp"
 
+namespace
+{
+  // Has no nested type, evaluating it breaks the compilation
+  struct not_evaluated {};
+}
+
 BOOST_AUTO_TEST_CASE(test_exception)
 {
   using boost::is_same;
@@ -72,6 +78,29 @@ BOOST_AUTO_TEST_CASE(test_exception)
     >
   ));
 
+  // test_rest_of_do_is_not_evaluated_after_exception
+  BOOST_MPL_ASSERT((
+    equal_to<
+      exception<int13>,
+      do_c<exception_tag,
+        apply<lambda_c<_, e>, int1>,
+        not_evaluated,
+        not_evaluated
+      >::type
+    >
+  ));
+
+  // test_rest_of_do_is_not_evaluated_after_exception_in_set
+  BOOST_MPL_ASSERT((
+    equal_to<
+      exception<int13>,
+      do_c<exception_tag,
+        set<x, apply<lambda_c<_, e>, int1> >,
+        not_evaluated
+      >::type
+    >
+  ));
+
   // test_return_value
   BOOST_MPL_ASSERT((is_same<int13, return_<exception_tag, int13>::type>));
 
@@ -10,6 +10,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <boost/mpl/vector.hpp>
+#include <boost/mpl/list.hpp>
 #include <boost/mpl/assert.hpp>
 
 #include <boost/type_traits.hpp>
@@ -28,6 +29,7 @@ BOOST_AUTO_TEST_CASE(test_instantiate)
   using mpllibs::metamonad::apply;
 
   using boost::mpl::vector;
+  using boost::mpl::list;
   using boost::mpl::na;
 
   using boost::is_same;
@@ -47,6 +49,22 @@ BOOST_AUTO_TEST_CASE(test_instantiate)
       apply<instantiate2<some_template>, vector<int> >::type
     >
   ));
+
+  // test_instantiation_with_longer_sequence
+  BOOST_MPL_ASSERT((
+    is_same<
+      some_template<int, double>,
+      apply<instantiate2<some_template>, vector<int, double, char> >::type
+    >
+  ));
+
+  // test_instantiation_from_forward_sequence
+  BOOST_MPL_ASSERT((
+    is_same<
+      some_template<int, double>,
+      apply<instantiate2<some_template>, list<int, double> >::type
+    >
+  ));
 }
 
 
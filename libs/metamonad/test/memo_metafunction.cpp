@@ -0,0 +1,122 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/memo_metafunction.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/integral_c.hpp>
+#include <boost/mpl/plus.hpp>
+#include <boost/mpl/minus.hpp>
+#include <boost/mpl/times.hpp>
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/less.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/assert.hpp>
+
+#include <boost/type_traits/is_base_of.hpp>
+
+using boost::mpl::int_;
+using boost::mpl::plus;
+using boost::mpl::minus;
+using boost::mpl::times;
+using boost::mpl::equal_to;
+using boost::mpl::less;
+using boost::mpl::eval_if;
+
+namespace
+{
+  // Counting the instances of the body of fib
+  int fib_body_instances = 0;
+
+  template <class N>
+  struct count_instance
+  {
+    static int id;
+  };
+
+  template <class N>
+  int count_instance<N>::id = ++fib_body_instances;
+
+  template <int*>
+  struct force_instantiation {};
+
+  template <class N, class Body>
+  struct counted : Body
+  {
+    typedef force_instantiation<&count_instance<N>::id> force;
+  };
+
+  template <class N>
+  struct fib_sum;
+
+  MPLLIBS_MEMO_METAFUNCTION(fib, (N))
+  ((counted<N, eval_if<less<N, int_<2> >, int_<1>, fib_sum<N> > >));
+
+  template <class N>
+  struct fib_sum :
+    plus<
+      typename fib<minus<N, int_<1> > >::type,
+      typename fib<minus<N, int_<2> > >::type
+    >
+  {};
+
+  MPLLIBS_MEMO_METAFUNCTION(double_value, (N)) ((times<N, int_<2> >));
+
+  MPLLIBS_MEMO_METAFUNCTION(mult, (A)(B)) ((times<A, B>));
+}
+
+BOOST_AUTO_TEST_CASE(test_memo_metafunction)
+{
+  using boost::mpl::apply_wrap1;
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::integral_c;
+  using boost::is_base_of;
+
+  // test_metafunction
+  BOOST_MPL_ASSERT((equal_to<int_<6>, double_value<int_<3> >::type>));
+
+  // test_arguments_are_evaluated
+  BOOST_MPL_ASSERT((
+    equal_to<int_<6>, double_value<plus<int_<1>, int_<2> > >::type>
+  ));
+
+  // test_metafunction_with_two_arguments
+  BOOST_MPL_ASSERT((equal_to<int_<6>, mult<int_<2>, int_<3> >::type>));
+
+  // test_currying
+  BOOST_MPL_ASSERT((
+    equal_to<int_<6>, apply_wrap1<mult<int_<2> >::type, int_<3> >::type>
+  ));
+
+  // test_using_metafunction_as_metafunction_class
+  BOOST_MPL_ASSERT((
+    equal_to<int_<6>, apply_wrap2<mult<>, int_<2>, int_<3> >::type>
+  ));
+
+  // test_equal_arguments_share_the_body
+  BOOST_MPL_ASSERT((
+    is_base_of<
+      double_value__impl<integral_c<int, 3> >,
+      double_value___impl<int_<3> >
+    >
+  ));
+  BOOST_MPL_ASSERT((
+    is_base_of<
+      double_value__impl<integral_c<int, 3> >,
+      double_value___impl<minus<int_<4>, int_<1> > >
+    >
+  ));
+
+  // test_rec_memo_metafunction
+  BOOST_MPL_ASSERT((equal_to<int_<10946>, fib<int_<20> >::type>));
+
+  // test_body_is_instantiated_once_for_each_value
+  BOOST_CHECK_EQUAL(21, fib_body_instances);
+}
+
+
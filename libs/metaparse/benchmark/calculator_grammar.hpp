@@ -0,0 +1,63 @@
+#ifndef MPLLIBS_METAPARSE_BENCHMARK_CALCULATOR_GRAMMAR_HPP
+#define MPLLIBS_METAPARSE_BENCHMARK_CALCULATOR_GRAMMAR_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/grammar.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+// The grammar profiled by the metaparse_grammar_profile target
+//
+// ws ::= ' '*
+// i ::= int ws
+// plus ::= '+' ws
+// times ::= '*' ws
+// term ::= i (times i)*
+// exp ::= term (plus term)*
+typedef
+  mpllibs::metaparse::grammar<mpllibs::metaparse::string<'e','x','p'> >
+    ::import<
+      mpllibs::metaparse::string<'i','n','t'>,
+      mpllibs::metaparse::int_
+    >::type
+
+    ::rule<
+      mpllibs::metaparse::string<
+        'w','s',' ',':',':','=',' ','\'',' ','\'','*'
+      >
+    >::type
+    ::rule<
+      mpllibs::metaparse::string<
+        'i',' ',':',':','=',' ','i','n','t',' ','w','s'
+      >
+    >::type
+    ::rule<
+      mpllibs::metaparse::string<
+        'p','l','u','s',' ',':',':','=',' ','\'','+','\'',' ','w','s'
+      >
+    >::type
+    ::rule<
+      mpllibs::metaparse::string<
+        't','i','m','e','s',' ',':',':','=',' ','\'','*','\'',' ','w','s'
+      >
+    >::type
+    ::rule<
+      mpllibs::metaparse::string<
+        't','e','r','m',' ',':',':','=',' ','i',' ','(','t','i','m','e','s',
+        ' ','i',')','*'
+      >
+    >::type
+    ::rule<
+      mpllibs::metaparse::string<
+        'e','x','p',' ',':',':','=',' ','t','e','r','m',' ','(','p','l','u',
+        's',' ','t','e','r','m',')','*'
+      >
+    >::type
+  calculator_grammar;
+
+#endif
+
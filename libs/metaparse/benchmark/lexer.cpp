@@ -0,0 +1,130 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Parses a list of definitions (name = value), declarations (name : value)
+// and names. The alternatives start with the same name token, thus the name
+// is read again after every failing alternative. With
+// MPLLIBS_BENCHMARK_LEXER the input is turned into tokens by a lexer first and
+// the alternatives are applied to the tokens.
+
+#define MPLLIBS_LIMIT_STRING_SIZE 64
+
+#include <mpllibs/metaparse/any.hpp>
+#include <mpllibs/metaparse/any1.hpp>
+#include <mpllibs/metaparse/build_parser.hpp>
+#include <mpllibs/metaparse/entire_input.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+#include <mpllibs/metaparse/letter.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/one_of.hpp>
+#include <mpllibs/metaparse/sequence.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#ifdef MPLLIBS_BENCHMARK_LEXER
+
+#include <mpllibs/metaparse/lexer.hpp>
+#include <mpllibs/metaparse/lex_rule.hpp>
+#include <mpllibs/metaparse/lex_skip.hpp>
+#include <mpllibs/metaparse/lexed.hpp>
+#include <mpllibs/metaparse/spaces.hpp>
+#include <mpllibs/metaparse/token_kind.hpp>
+
+#include <boost/mpl/vector.hpp>
+
+namespace
+{
+  struct name_token;
+  struct eq_token;
+  struct colon_token;
+  struct int_token;
+
+  typedef
+    mpllibs::metaparse::lexer<
+      boost::mpl::vector<
+        mpllibs::metaparse::lex_rule<
+          name_token,
+          mpllibs::metaparse::any1<mpllibs::metaparse::letter>
+        >,
+        mpllibs::metaparse::lex_rule<
+          eq_token,
+          mpllibs::metaparse::lit_c<'='>
+        >,
+        mpllibs::metaparse::lex_rule<
+          colon_token,
+          mpllibs::metaparse::lit_c<':'>
+        >,
+        mpllibs::metaparse::lex_rule<int_token, mpllibs::metaparse::int_>,
+        mpllibs::metaparse::lex_skip<mpllibs::metaparse::spaces>
+      >
+    >
+    benchmark_lexer;
+
+  typedef mpllibs::metaparse::token_kind<name_token> name;
+  typedef mpllibs::metaparse::token_kind<eq_token> eq;
+  typedef mpllibs::metaparse::token_kind<colon_token> colon;
+  typedef mpllibs::metaparse::token_kind<int_token> value;
+}
+
+#else
+
+#include <mpllibs/metaparse/token.hpp>
+
+namespace
+{
+  typedef
+    mpllibs::metaparse::token<
+      mpllibs::metaparse::any1<mpllibs::metaparse::letter>
+    >
+    name;
+  typedef mpllibs::metaparse::token<mpllibs::metaparse::lit_c<'='> > eq;
+  typedef mpllibs::metaparse::token<mpllibs::metaparse::lit_c<':'> > colon;
+  typedef mpllibs::metaparse::token<mpllibs::metaparse::int_> value;
+}
+
+#endif
+
+namespace
+{
+  typedef
+    mpllibs::metaparse::one_of<
+      mpllibs::metaparse::sequence<name, eq, value>,
+      mpllibs::metaparse::sequence<name, colon, value>,
+      name
+    >
+    item;
+
+#ifdef MPLLIBS_BENCHMARK_LEXER
+  typedef
+    mpllibs::metaparse::build_parser<
+      mpllibs::metaparse::entire_input<
+        mpllibs::metaparse::lexed<
+          benchmark_lexer,
+          mpllibs::metaparse::any<item>
+        >
+      >
+    >
+    benchmark_parser;
+#else
+  typedef
+    mpllibs::metaparse::build_parser<
+      mpllibs::metaparse::entire_input<mpllibs::metaparse::any<item> >
+    >
+    benchmark_parser;
+#endif
+
+  typedef
+    mpllibs::metaparse::string<
+    'a','b',':','1',' ','c','d','e',' ','f','g','=','2','3',' ','h','i','j',
+    ':','4',' ','k','l',' ','m','n','=','5','6',' ','o',':','7',' ','p','q',
+    'r',' ','s','t','=','8',' ','u','v',':','9','0',' ','w','x','y',' ','z',
+    '=','1',' ','a','b',':','2',' ','c','d'
+    >
+    benchmark_input;
+}
+
+typedef benchmark_parser::apply<benchmark_input>::type benchmark_result;
+
+int main() {}
+
@@ -0,0 +1,98 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_NO_CONSTEXPR
+#include <iostream>
+
+int main()
+{
+  std::cout << "Please use a compiler that supports constexpr" << std::endl;
+}
+#else
+
+#define MPLLIBS_LIMIT_STRING_SIZE 64
+
+#include <mpllibs/metaparse/lalr_grammar.hpp>
+#include <mpllibs/metaparse/entire_input.hpp>
+#include <mpllibs/metaparse/build_parser.hpp>
+#include <mpllibs/metaparse/token.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/plus.hpp>
+#include <boost/mpl/minus.hpp>
+#include <boost/mpl/times.hpp>
+#include <boost/mpl/divides.hpp>
+#include <boost/mpl/int.hpp>
+
+#include <iostream>
+
+using mpllibs::metaparse::build_parser;
+using mpllibs::metaparse::entire_input;
+using mpllibs::metaparse::token;
+using mpllibs::metaparse::lit_c;
+using mpllibs::metaparse::lalr_grammar;
+
+using boost::mpl::apply_wrap1;
+using boost::mpl::at;
+using boost::mpl::plus;
+using boost::mpl::minus;
+using boost::mpl::times;
+using boost::mpl::divides;
+using boost::mpl::_1;
+using boost::mpl::int_;
+
+#ifdef _STR
+  #error _STR already defined
+#endif
+#define _STR MPLLIBS_STRING
+
+// The result of a rule with more symbols is the vector of their results
+typedef plus<at<_1, int_<0>>, at<_1, int_<2>>> plus_action;
+typedef minus<at<_1, int_<0>>, at<_1, int_<2>>> minus_action;
+typedef times<at<_1, int_<0>>, at<_1, int_<2>>> times_action;
+typedef divides<at<_1, int_<0>>, at<_1, int_<2>>> divides_action;
+
+typedef
+  lalr_grammar<_STR("exp")>
+    ::import<_STR("int_token"), token<mpllibs::metaparse::int_>>::type
+    ::import<_STR("plus_token"), token<lit_c<'+'>>>::type
+    ::import<_STR("minus_token"), token<lit_c<'-'>>>::type
+    ::import<_STR("times_token"), token<lit_c<'*'>>>::type
+    ::import<_STR("divides_token"), token<lit_c<'/'>>>::type
+    ::import<_STR("open_token"), token<lit_c<'('>>>::type
+    ::import<_STR("close_token"), token<lit_c<')'>>>::type
+
+    ::left<_STR("plus_token minus_token")>::type
+    ::left<_STR("times_token divides_token")>::type
+
+    ::rule<_STR("exp ::= exp plus_token exp"), plus_action>::type
+    ::rule<_STR("exp ::= exp minus_token exp"), minus_action>::type
+    ::rule<_STR("exp ::= exp times_token exp"), times_action>::type
+    ::rule<_STR("exp ::= exp divides_token exp"), divides_action>::type
+    ::rule<_STR("exp ::= open_token exp close_token"), at<_1, int_<1>>>::type
+    ::rule<_STR("exp ::= int_token")>::type
+  expression;
+
+typedef build_parser<entire_input<expression>> calculator_parser;
+
+int main()
+{
+  using std::cout;
+  using std::endl;
+  
+  cout
+    << apply_wrap1<calculator_parser, _STR("13")>::type::value << endl
+    << apply_wrap1<calculator_parser, _STR("1+ 2*4-6/2")>::type::value << endl
+    << apply_wrap1<calculator_parser, _STR("(1+2)*(3+4)")>::type::value << endl
+    ;
+}
+#endif
+
@@ -14,6 +14,7 @@
 #include <mpllibs/metaparse/middle_of.hpp>
 #include <mpllibs/metaparse/entire_input.hpp>
 #include <mpllibs/metaparse/string.hpp>
+#include <mpllibs/metaparse/regex_matcher.hpp>
 
 #include <boost/xpressive/xpressive.hpp>
 
@@ -30,6 +31,7 @@ using mpllibs::metaparse::always_c;
 using mpllibs::metaparse::middle_of;
 using mpllibs::metaparse::one_char_except_c;
 using mpllibs::metaparse::entire_input;
+using mpllibs::metaparse::regex_matcher;
 
 using boost::mpl::c_str;
 using boost::mpl::true_;
@@ -142,6 +144,14 @@ void test_string(const std::string& s)
     << s << (regex_match(s, w, re) ? " matches " : " doesn't match ")
     << c_str<regexp>::type::value
     << endl;
+
+  // The same check using the automaton built at compile-time
+  cout
+    << s
+    << (regex_matcher<regexp>::match(s) ? " matches " : " doesn't match ")
+    << c_str<regexp>::type::value
+    << " (regex_matcher)"
+    << endl;
 }
 
 int main()
@@ -16,7 +16,25 @@
 #include <mpllibs/metaparse/any_one_of.hpp>
 #include <mpllibs/metaparse/build_parser.hpp>
 #include <mpllibs/metaparse/change_error_message.hpp>
+#include <mpllibs/metaparse/char_class_c.hpp>
+#include <mpllibs/metaparse/char_class_difference.hpp>
+#include <mpllibs/metaparse/char_class.hpp>
+#include <mpllibs/metaparse/char_class_not.hpp>
+#include <mpllibs/metaparse/char_class_range_c.hpp>
+#include <mpllibs/metaparse/char_class_union.hpp>
 #include <mpllibs/metaparse/config.hpp>
+#include <mpllibs/metaparse/cx/any.hpp>
+#include <mpllibs/metaparse/cx/build_parser.hpp>
+#include <mpllibs/metaparse/cx/foldl.hpp>
+#include <mpllibs/metaparse/cx/int_.hpp>
+#include <mpllibs/metaparse/cx/lit_c.hpp>
+#include <mpllibs/metaparse/cx/one_char.hpp>
+#include <mpllibs/metaparse/cx/one_of.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+#include <mpllibs/metaparse/cx/result.hpp>
+#include <mpllibs/metaparse/cx/sequence.hpp>
+#include <mpllibs/metaparse/cx/token.hpp>
+#include <mpllibs/metaparse/cx/values.hpp>
 #include <mpllibs/metaparse/debug_parsing_error.hpp>
 #include <mpllibs/metaparse/define_error.hpp>
 #include <mpllibs/metaparse/digit.hpp>
@@ -25,12 +43,14 @@
 #include <mpllibs/metaparse/entire_input.hpp>
 #include <mpllibs/metaparse/error/digit_expected.hpp>
 #include <mpllibs/metaparse/error/end_of_input_expected.hpp>
+#include <mpllibs/metaparse/error/expected_one_of.hpp>
 #include <mpllibs/metaparse/error/index_out_of_range.hpp>
 #include <mpllibs/metaparse/error/letter_expected.hpp>
 #include <mpllibs/metaparse/error/literal_expected.hpp>
 #include <mpllibs/metaparse/error/none_of_the_expected_cases_found.hpp>
 #include <mpllibs/metaparse/error/unexpected_character.hpp>
 #include <mpllibs/metaparse/error/unexpected_end_of_input.hpp>
+#include <mpllibs/metaparse/error/unexpected_token.hpp>
 #include <mpllibs/metaparse/error/whitespace_expected.hpp>
 #include <mpllibs/metaparse/except.hpp>
 #include <mpllibs/metaparse/fail.hpp>
@@ -50,13 +70,22 @@
 #include <mpllibs/metaparse/get_result.hpp>
 #include <mpllibs/metaparse/grammar.hpp>
 #include <mpllibs/metaparse/if_.hpp>
+#include <mpllibs/metaparse/infix_left_op.hpp>
+#include <mpllibs/metaparse/infix_right_op.hpp>
 #include <mpllibs/metaparse/int_.hpp>
 #include <mpllibs/metaparse/is_error.hpp>
 #include <mpllibs/metaparse/iterate_c.hpp>
 #include <mpllibs/metaparse/iterate.hpp>
 #include <mpllibs/metaparse/keyword.hpp>
+#include <mpllibs/metaparse/lalr_grammar.hpp>
 #include <mpllibs/metaparse/last_of.hpp>
+#include <mpllibs/metaparse/lex_rule.hpp>
+#include <mpllibs/metaparse/lex_skip.hpp>
+#include <mpllibs/metaparse/lex_token.hpp>
+#include <mpllibs/metaparse/lexed.hpp>
+#include <mpllibs/metaparse/lexer.hpp>
 #include <mpllibs/metaparse/letter.hpp>
+#include <mpllibs/metaparse/limit_char_class_size.hpp>
 #include <mpllibs/metaparse/limit_one_char_except_size.hpp>
 #include <mpllibs/metaparse/limit_one_of_size.hpp>
 #include <mpllibs/metaparse/limit_sequence_size.hpp>
@@ -74,8 +103,14 @@
 #include <mpllibs/metaparse/one_char.hpp>
 #include <mpllibs/metaparse/one_of_c.hpp>
 #include <mpllibs/metaparse/one_of.hpp>
+#include <mpllibs/metaparse/operator_precedence.hpp>
 #include <mpllibs/metaparse/parser_monad.hpp>
 #include <mpllibs/metaparse/parser_tag.hpp>
+#include <mpllibs/metaparse/prefix_op.hpp>
+#include <mpllibs/metaparse/print_trace.hpp>
+#include <mpllibs/metaparse/regex.hpp>
+#include <mpllibs/metaparse/regex_match.hpp>
+#include <mpllibs/metaparse/regex_matcher.hpp>
 #include <mpllibs/metaparse/return_.hpp>
 #include <mpllibs/metaparse/sequence.hpp>
 #include <mpllibs/metaparse/source_position.hpp>
@@ -86,10 +121,12 @@
 #include <mpllibs/metaparse/string.hpp>
 #include <mpllibs/metaparse/string_tag.hpp>
 #include <mpllibs/metaparse/token.hpp>
+#include <mpllibs/metaparse/token_kind.hpp>
 #include <mpllibs/metaparse/transform.hpp>
 #include <mpllibs/metaparse/unless_error.hpp>
 #include <mpllibs/metaparse/util/digit_to_int_c.hpp>
 #include <mpllibs/metaparse/util/digit_to_int.hpp>
+#include <mpllibs/metaparse/util/in_char_class.hpp>
 #include <mpllibs/metaparse/util/in_range.hpp>
 #include <mpllibs/metaparse/util/int_to_digit_c.hpp>
 #include <mpllibs/metaparse/util/int_to_digit.hpp>
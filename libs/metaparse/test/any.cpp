@@ -4,10 +4,42 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metaparse/any.hpp>
+#include <mpllibs/metaparse/get_col.hpp>
+#include <mpllibs/metaparse/get_position.hpp>
 
 using mpllibs::metaparse::any;
 
 #define DEFINE_TEST_CASE BOOST_AUTO_TEST_CASE(test_any)
 
-#include "any_test.hpp"  
+#include "any_test.hpp"
+
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/int.hpp>
+
+BOOST_AUTO_TEST_CASE(test_any_long_repetition)
+{
+  using mpllibs::metaparse::get_position;
+  using mpllibs::metaparse::get_col;
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::start;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::mpl::front;
+  using boost::mpl::int_;
+  using boost::mpl::size;
+
+  typedef apply_wrap2<any<accept_until_col<1000> >, str_, start> r;
+
+  // test_long_repetition
+  BOOST_MPL_ASSERT((
+    equal_to<size<get_result<r>::type>::type, int_<1000> >
+  ));
+
+  // test_first_element_of_long_repetition
+  BOOST_MPL_ASSERT((equal_to<front<get_result<r>::type>::type, int_<1> >));
+
+  // test_position_after_long_repetition
+  BOOST_MPL_ASSERT((equal_to<get_col<get_position<r> >::type, int_<1001> >));
+}
 
@@ -0,0 +1,128 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/char_class.hpp>
+#include <mpllibs/metaparse/char_class_c.hpp>
+#include <mpllibs/metaparse/char_class_difference.hpp>
+#include <mpllibs/metaparse/char_class_not.hpp>
+#include <mpllibs/metaparse/char_class_range_c.hpp>
+#include <mpllibs/metaparse/char_class_union.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/get_remaining.hpp>
+#include <mpllibs/metaparse/util/in_char_class.hpp>
+
+#include "common.hpp"
+
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/equal.hpp>
+#include <boost/mpl/apply.hpp>
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/not.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_char_class)
+{
+  using mpllibs::metaparse::is_error;
+  using mpllibs::metaparse::char_class;
+  using mpllibs::metaparse::char_class_c;
+  using mpllibs::metaparse::char_class_difference;
+  using mpllibs::metaparse::char_class_not;
+  using mpllibs::metaparse::char_class_range_c;
+  using mpllibs::metaparse::char_class_union;
+  using mpllibs::metaparse::start;
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::get_remaining;
+  using mpllibs::metaparse::util::in_char_class;
+
+  using boost::mpl::apply;
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::mpl::equal;
+  using boost::mpl::not_;
+
+  // 'h' is character 104: bit 8 of word 3
+  typedef char_class<0, 0, 0, 1ul << 8> class_h;
+
+  // test_accept
+  BOOST_MPL_ASSERT((
+    equal_to<get_result<apply_wrap2<class_h, str_hello, start> >::type, char_h>
+  ));
+
+  // test_remaining
+  BOOST_MPL_ASSERT((
+    equal<
+      get_remaining<apply_wrap2<class_h, str_hello, start> >::type,
+      boost::mpl::list_c<char, 'e', 'l', 'l', 'o'>
+    >
+  ));
+
+  // test_reject
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<class_h, str_bello, start> >));
+
+  // test_empty_input
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<class_h, str_, start> >));
+
+  // test_empty_class
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<char_class<>, str_hello, start> >));
+
+  typedef char_class_c<'a', 'b', 'c'> abc;
+  typedef char_class_c<'b', 'h'> bh;
+
+  // test_union
+  typedef char_class_union<abc, bh> abch;
+
+  BOOST_MPL_ASSERT((apply<in_char_class<abch>, char_a>));
+  BOOST_MPL_ASSERT((apply<in_char_class<abch>, char_b>));
+  BOOST_MPL_ASSERT((apply<in_char_class<abch>, char_h>));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<abch>, char_e> >));
+
+  // test_difference
+  typedef char_class_difference<abc, bh> ac;
+
+  BOOST_MPL_ASSERT((apply<in_char_class<ac>, char_a>));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<ac>, char_b> >));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<ac>, char_h> >));
+
+  // test_not
+  typedef char_class_not<abc> not_abc;
+
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<not_abc>, char_a> >));
+  BOOST_MPL_ASSERT((apply<in_char_class<not_abc>, char_h>));
+  BOOST_MPL_ASSERT((apply<in_char_class<not_abc>, char_space>));
+
+  // test_not_of_empty_class_accepts_everything
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<
+        apply_wrap2<char_class_not<char_class<> >, str_hello, start>
+      >::type,
+      char_h
+    >
+  ));
+
+  // test_set_operations_are_parsers
+  BOOST_MPL_ASSERT((
+    equal_to<get_result<apply_wrap2<abch, str_hello, start> >::type, char_h>
+  ));
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<ac, str_bello, start> >));
+
+  // test_combining_ranges
+  typedef
+    char_class_difference<
+      char_class_range_c<'a', 'z'>,
+      char_class_range_c<'f', 'k'>
+    >
+    a_z_except_f_k;
+
+  BOOST_MPL_ASSERT((apply<in_char_class<a_z_except_f_k>, char_e>));
+  BOOST_MPL_ASSERT((apply<in_char_class<a_z_except_f_k>, char_l>));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<a_z_except_f_k>, char_h> >));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<a_z_except_f_k>, char_k> >));
+}
+
@@ -0,0 +1,53 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/char_class_c.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+
+#include "common.hpp"
+
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_char_class_c)
+{
+  using mpllibs::metaparse::is_error;
+  using mpllibs::metaparse::char_class_c;
+  using mpllibs::metaparse::start;
+  using mpllibs::metaparse::get_result;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+
+  // test_empty_class
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<char_class_c<>, str_hello, start> >));
+
+  // test_with_good
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<char_class_c<'x', 'h'>, str_hello, start> >::type,
+      char_h
+    >
+  ));
+
+  // test_with_bad
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<char_class_c<'x', 'e'>, str_hello, start> >
+  ));
+
+  // test_with_empty_string
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<char_class_c<'h'>, str_, start> >));
+
+  // test_non_characters_are_ignored
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<char_class_c<'h' + 256, 1024>, str_hello, start> >
+  ));
+}
+
@@ -0,0 +1,94 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/char_class_range_c.hpp>
+#include <mpllibs/metaparse/util/in_char_class.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+
+#include "common.hpp"
+
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/apply.hpp>
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/char.hpp>
+#include <boost/mpl/not.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <climits>
+
+BOOST_AUTO_TEST_CASE(test_char_class_range_c)
+{
+  using mpllibs::metaparse::is_error;
+  using mpllibs::metaparse::char_class_range_c;
+  using mpllibs::metaparse::util::in_char_class;
+  using mpllibs::metaparse::start;
+  using mpllibs::metaparse::get_result;
+
+  using boost::mpl::apply;
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::mpl::char_;
+  using boost::mpl::not_;
+
+  typedef char_class_range_c<'0', '9'> digits;
+
+  // test_with_text
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<digits, str_hello, start> >));
+
+  // test_with_number
+  BOOST_MPL_ASSERT((
+    equal_to<get_result<apply_wrap2<digits, str_1983, start> >::type, char_1>
+  ));
+
+  // test_with_empty_string
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<digits, str_, start> >));
+
+  // test_range_spanning_more_words
+  typedef char_class_range_c<' ', 'z'> printable;
+
+  BOOST_MPL_ASSERT((apply<in_char_class<printable>, char_space>));
+  BOOST_MPL_ASSERT((apply<in_char_class<printable>, char_0>));
+  BOOST_MPL_ASSERT((apply<in_char_class<printable>, char_K>));
+  BOOST_MPL_ASSERT((apply<in_char_class<printable>, char_x>));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<printable>, char_<'{'> > >));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<printable>, char_tab> >));
+
+  // test_single_character_range
+  BOOST_MPL_ASSERT((
+    apply<in_char_class<char_class_range_c<'a', 'a'> >, char_a>
+  ));
+  BOOST_MPL_ASSERT((
+    not_<apply<in_char_class<char_class_range_c<'a', 'a'> >, char_b> >
+  ));
+
+  // test_empty_range
+  BOOST_MPL_ASSERT((
+    not_<apply<in_char_class<char_class_range_c<'b', 'a'> >, char_a> >
+  ));
+
+  // test_range_at_the_end_of_the_codes
+  BOOST_MPL_ASSERT((
+    apply<
+      in_char_class<char_class_range_c<char(0xf0), char(0xff)> >,
+      char_<char(0xf5)>
+    >
+  ));
+
+#if CHAR_MIN < 0
+  // test_range_with_negative_and_non_negative_characters
+  typedef char_class_range_c<-2, 2> around_zero;
+
+  BOOST_MPL_ASSERT((apply<in_char_class<around_zero>, char_<-2> >));
+  BOOST_MPL_ASSERT((apply<in_char_class<around_zero>, char_<0> >));
+  BOOST_MPL_ASSERT((apply<in_char_class<around_zero>, char_<2> >));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<around_zero>, char_<3> > >));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<around_zero>, char_<-3> > >));
+#endif
+}
+
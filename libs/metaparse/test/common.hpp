@@ -6,8 +6,15 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
+#include <mpllibs/metaparse/fail.hpp>
+#include <mpllibs/metaparse/get_col.hpp>
 #include <mpllibs/metaparse/lit.hpp>
 #include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/next_char.hpp>
+#include <mpllibs/metaparse/return_.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/eval_if.hpp>
 
 #include <boost/mpl/list.hpp>
 #include <boost/mpl/list_c.hpp>
@@ -97,5 +104,32 @@ struct test_failure
   static std::string get_value() { return "fail"; }
 };
 
+// Accepts the input without consuming it until column N. Repeating it
+// needs no long input text.
+template <int N>
+struct accept_until_col
+{
+  typedef accept_until_col type;
+
+  template <class S, class Pos>
+  struct apply :
+    boost::mpl::eval_if_c<
+      (mpllibs::metaparse::get_col<Pos>::type::value <= N),
+      boost::mpl::apply_wrap2<
+        mpllibs::metaparse::return_<
+          typename mpllibs::metaparse::get_col<Pos>::type
+        >,
+        S,
+        typename mpllibs::metaparse::next_char<Pos, char_x>::type
+      >,
+      boost::mpl::apply_wrap2<
+        mpllibs::metaparse::fail<test_failure>,
+        S,
+        Pos
+      >
+    >
+  {};
+};
+
 #endif
 
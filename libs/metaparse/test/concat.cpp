@@ -37,6 +37,23 @@ BOOST_AUTO_TEST_CASE(test_concat)
       concat<hello, hello>::type
     >
   ));
+
+  // test_concat_to_longest_string
+  BOOST_MPL_ASSERT((
+    equal_to<
+      string<
+        'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p',
+        'q','r','s','t','u','v','w','x','y','z','A','B','C','D','E','F'
+      >,
+      concat<
+        string<
+          'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p',
+          'q','r','s','t','u','v','w','x','y','z'
+        >,
+        string<'A','B','C','D','E','F'>
+      >::type
+    >
+  ));
 }
 
 
@@ -0,0 +1,40 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// The headers needed to parse with lit_c and string do not include the MPL
+// containers. This file has to be compiled on its own, without a
+// precompiled header.
+
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/one_char.hpp>
+#include <mpllibs/metaparse/build_parser.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#ifdef BOOST_MPL_VECTOR_HPP_INCLUDED
+#  error The core headers include boost/mpl/vector.hpp
+#endif
+
+#ifdef BOOST_MPL_LIST_HPP_INCLUDED
+#  error The core headers include boost/mpl/list.hpp
+#endif
+
+#ifdef BOOST_MPL_DEQUE_HPP_INCLUDED
+#  error The core headers include boost/mpl/deque.hpp
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_core_headers)
+{
+  using mpllibs::metaparse::build_parser;
+  using mpllibs::metaparse::lit_c;
+  using mpllibs::metaparse::string;
+
+  // test_parsing_with_core_headers
+  BOOST_CHECK_EQUAL(
+    'a',
+    (build_parser<lit_c<'a'> >::apply<string<'a'> >::type::value)
+  );
+}
@@ -0,0 +1,56 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/any.hpp>
+#include <mpllibs/metaparse/cx/lit_c.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+// 4096 'a' characters
+#define A_16 "aaaaaaaaaaaaaaaa"
+#define A_256 A_16 A_16 A_16 A_16 A_16 A_16 A_16 A_16 \
+  A_16 A_16 A_16 A_16 A_16 A_16 A_16 A_16
+#define A_4096 A_256 A_256 A_256 A_256 A_256 A_256 A_256 A_256 \
+  A_256 A_256 A_256 A_256 A_256 A_256 A_256 A_256
+
+BOOST_AUTO_TEST_CASE(test_cx_any)
+{
+  using mpllibs::metaparse::cx::any;
+  using mpllibs::metaparse::cx::lit_c;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_empty_input
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >("").success);
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >("").value == 0);
+
+  // test_no_match
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >("b").success);
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >("b").value == 0);
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >("b").pos == 0);
+
+  // test_multiple_matches
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >("aaab").value == 3);
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >("aaab").pos == 3);
+
+  // test_long_input
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >(A_4096 "b").value == 4096);
+  BOOST_STATIC_ASSERT(parse<any<lit_c<'a'> > >(A_4096 "b").pos == 4096);
+
+  // test_parser_not_consuming_input
+  BOOST_STATIC_ASSERT(!parse<any<any<lit_c<'a'> > > >("aab").success);
+  BOOST_STATIC_ASSERT(parse<any<any<lit_c<'a'> > > >("aab").pos == 2);
+}
+
+#undef A_4096
+#undef A_256
+#undef A_16
+
+#endif
+
@@ -0,0 +1,42 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/build_parser.hpp>
+#include <mpllibs/metaparse/cx/int_.hpp>
+#include <mpllibs/metaparse/cx/token.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/assert.hpp>
+
+BOOST_AUTO_TEST_CASE(test_cx_build_parser)
+{
+  using mpllibs::metaparse::cx::build_parser;
+  using mpllibs::metaparse::cx::int_;
+  using mpllibs::metaparse::cx::token;
+
+  using boost::mpl::apply_wrap1;
+  using boost::mpl::equal_to;
+  using boost::mpl::int_;
+
+  typedef build_parser<token<mpllibs::metaparse::cx::int_> > int_parser;
+
+  // test_result_is_a_type
+  BOOST_MPL_ASSERT((
+    equal_to<int_<13>, apply_wrap1<int_parser, MPLLIBS_STRING("13 ")>::type>
+  ));
+}
+
+#endif
+
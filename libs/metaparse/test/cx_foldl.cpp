@@ -0,0 +1,74 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/foldl.hpp>
+#include <mpllibs/metaparse/cx/int_.hpp>
+#include <mpllibs/metaparse/cx/token.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+#include <boost/mpl/int.hpp>
+
+namespace
+{
+  struct sum
+  {
+    static constexpr int apply(int a_, int b_)
+    {
+      return a_ + b_;
+    }
+  };
+
+  typedef
+    mpllibs::metaparse::cx::foldl<
+      mpllibs::metaparse::cx::token<mpllibs::metaparse::cx::int_>,
+      boost::mpl::int_<0>,
+      sum
+    >
+    sum_ints;
+}
+
+// 2048 numbers
+#define ONES_16 "1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 "
+#define ONES_256 ONES_16 ONES_16 ONES_16 ONES_16 ONES_16 ONES_16 ONES_16 \
+  ONES_16 ONES_16 ONES_16 ONES_16 ONES_16 ONES_16 ONES_16 ONES_16 ONES_16
+#define ONES_2048 ONES_256 ONES_256 ONES_256 ONES_256 ONES_256 ONES_256 \
+  ONES_256 ONES_256
+
+BOOST_AUTO_TEST_CASE(test_cx_foldl)
+{
+  using mpllibs::metaparse::cx::foldl;
+  using mpllibs::metaparse::cx::int_;
+  using mpllibs::metaparse::cx::token;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_empty_input
+  BOOST_STATIC_ASSERT(parse<sum_ints>("").success);
+  BOOST_STATIC_ASSERT(parse<sum_ints>("").value == 0);
+
+  // test_one_element
+  BOOST_STATIC_ASSERT(parse<sum_ints>("13").value == 13);
+
+  // test_multiple_elements
+  BOOST_STATIC_ASSERT(parse<sum_ints>("1 2 3 x").success);
+  BOOST_STATIC_ASSERT(parse<sum_ints>("1 2 3 x").value == 6);
+  BOOST_STATIC_ASSERT(parse<sum_ints>("1 2 3 x").pos == 6);
+
+  // test_long_input
+  BOOST_STATIC_ASSERT(parse<sum_ints>(ONES_2048).value == 2048);
+  BOOST_STATIC_ASSERT(parse<sum_ints>(ONES_2048).pos == 4096);
+}
+
+#undef ONES_2048
+#undef ONES_256
+#undef ONES_16
+
+#endif
+
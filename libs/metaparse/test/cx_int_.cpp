@@ -0,0 +1,37 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/int_.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+BOOST_AUTO_TEST_CASE(test_cx_int_)
+{
+  using mpllibs::metaparse::cx::int_;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_accept
+  BOOST_STATIC_ASSERT(parse<int_>("13").success);
+  BOOST_STATIC_ASSERT(parse<int_>("13").value == 13);
+  BOOST_STATIC_ASSERT(parse<int_>("0").value == 0);
+
+  // test_remaining_input
+  BOOST_STATIC_ASSERT(parse<int_>("1983a").value == 1983);
+  BOOST_STATIC_ASSERT(parse<int_>("1983a").pos == 4);
+
+  // test_reject
+  BOOST_STATIC_ASSERT(!parse<int_>("a").success);
+
+  // test_with_empty_string
+  BOOST_STATIC_ASSERT(!parse<int_>("").success);
+}
+
+#endif
+
@@ -0,0 +1,34 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/lit_c.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+BOOST_AUTO_TEST_CASE(test_cx_lit_c)
+{
+  using mpllibs::metaparse::cx::lit_c;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_accept
+  BOOST_STATIC_ASSERT(parse<lit_c<'h'> >("hello").success);
+  BOOST_STATIC_ASSERT(parse<lit_c<'h'> >("hello").value == 'h');
+  BOOST_STATIC_ASSERT(parse<lit_c<'h'> >("hello").pos == 1);
+
+  // test_reject
+  BOOST_STATIC_ASSERT(!parse<lit_c<'h'> >("bello").success);
+  BOOST_STATIC_ASSERT(parse<lit_c<'h'> >("bello").pos == 0);
+
+  // test_with_empty_string
+  BOOST_STATIC_ASSERT(!parse<lit_c<'h'> >("").success);
+}
+
+#endif
+
@@ -0,0 +1,30 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/one_char.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+BOOST_AUTO_TEST_CASE(test_cx_one_char)
+{
+  using mpllibs::metaparse::cx::one_char;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_accept
+  BOOST_STATIC_ASSERT(parse<one_char>("hello").success);
+  BOOST_STATIC_ASSERT(parse<one_char>("hello").value == 'h');
+  BOOST_STATIC_ASSERT(parse<one_char>("hello").pos == 1);
+
+  // test_with_empty_string
+  BOOST_STATIC_ASSERT(!parse<one_char>("").success);
+}
+
+#endif
+
@@ -0,0 +1,49 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/one_of.hpp>
+#include <mpllibs/metaparse/cx/lit_c.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace
+{
+  typedef
+    mpllibs::metaparse::cx::one_of<
+      mpllibs::metaparse::cx::lit_c<'a'>,
+      mpllibs::metaparse::cx::lit_c<'b'>
+    >
+    a_or_b;
+}
+
+BOOST_AUTO_TEST_CASE(test_cx_one_of)
+{
+  using mpllibs::metaparse::cx::one_of;
+  using mpllibs::metaparse::cx::lit_c;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_first_accepts
+  BOOST_STATIC_ASSERT(parse<a_or_b>("ac").success);
+  BOOST_STATIC_ASSERT(parse<a_or_b>("ac").value == 'a');
+
+  // test_second_accepts
+  BOOST_STATIC_ASSERT(parse<a_or_b>("bc").success);
+  BOOST_STATIC_ASSERT(parse<a_or_b>("bc").value == 'b');
+  BOOST_STATIC_ASSERT(parse<a_or_b>("bc").pos == 1);
+
+  // test_none_accepts
+  BOOST_STATIC_ASSERT(!parse<a_or_b>("cc").success);
+
+  // test_one_parser
+  BOOST_STATIC_ASSERT(parse<one_of<lit_c<'a'> > >("a").success);
+}
+
+#endif
+
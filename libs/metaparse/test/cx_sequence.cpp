@@ -0,0 +1,58 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/sequence.hpp>
+#include <mpllibs/metaparse/cx/lit_c.hpp>
+#include <mpllibs/metaparse/cx/int_.hpp>
+#include <mpllibs/metaparse/cx/values.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace
+{
+  typedef
+    mpllibs::metaparse::cx::sequence<
+      mpllibs::metaparse::cx::lit_c<'a'>,
+      mpllibs::metaparse::cx::int_,
+      mpllibs::metaparse::cx::lit_c<'b'>
+    >
+    a_int_b;
+}
+
+BOOST_AUTO_TEST_CASE(test_cx_sequence)
+{
+  using mpllibs::metaparse::cx::sequence;
+  using mpllibs::metaparse::cx::lit_c;
+  using mpllibs::metaparse::cx::int_;
+  using mpllibs::metaparse::cx::get;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_accept
+  BOOST_STATIC_ASSERT(parse<a_int_b>("a13bc").success);
+  BOOST_STATIC_ASSERT(get<0>(parse<a_int_b>("a13bc").value) == 'a');
+  BOOST_STATIC_ASSERT(get<1>(parse<a_int_b>("a13bc").value) == 13);
+  BOOST_STATIC_ASSERT(get<2>(parse<a_int_b>("a13bc").value) == 'b');
+  BOOST_STATIC_ASSERT(parse<a_int_b>("a13bc").pos == 4);
+
+  // test_first_rejects
+  BOOST_STATIC_ASSERT(!parse<a_int_b>("b13b").success);
+  BOOST_STATIC_ASSERT(parse<a_int_b>("b13b").pos == 0);
+
+  // test_last_rejects
+  BOOST_STATIC_ASSERT(!parse<a_int_b>("a13c").success);
+  BOOST_STATIC_ASSERT(parse<a_int_b>("a13c").pos == 3);
+
+  // test_empty_sequence
+  BOOST_STATIC_ASSERT(parse<sequence<> >("a").success);
+  BOOST_STATIC_ASSERT(parse<sequence<> >("a").pos == 0);
+}
+
+#endif
+
@@ -0,0 +1,57 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/cx/token.hpp>
+#include <mpllibs/metaparse/cx/lit_c.hpp>
+#include <mpllibs/metaparse/cx/parse.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+// 4096 spaces
+#define SPACES_16 "                "
+#define SPACES_256 SPACES_16 SPACES_16 SPACES_16 SPACES_16 SPACES_16 \
+  SPACES_16 SPACES_16 SPACES_16 SPACES_16 SPACES_16 SPACES_16 SPACES_16 \
+  SPACES_16 SPACES_16 SPACES_16 SPACES_16
+#define SPACES_4096 SPACES_256 SPACES_256 SPACES_256 SPACES_256 SPACES_256 \
+  SPACES_256 SPACES_256 SPACES_256 SPACES_256 SPACES_256 SPACES_256 \
+  SPACES_256 SPACES_256 SPACES_256 SPACES_256 SPACES_256
+
+BOOST_AUTO_TEST_CASE(test_cx_token)
+{
+  using mpllibs::metaparse::cx::token;
+  using mpllibs::metaparse::cx::lit_c;
+  using mpllibs::metaparse::cx::parse;
+
+  // test_no_whitespace
+  BOOST_STATIC_ASSERT(parse<token<lit_c<'a'> > >("ab").success);
+  BOOST_STATIC_ASSERT(parse<token<lit_c<'a'> > >("ab").pos == 1);
+
+  // test_whitespaces
+  BOOST_STATIC_ASSERT(parse<token<lit_c<'a'> > >("a \t\nb").value == 'a');
+  BOOST_STATIC_ASSERT(parse<token<lit_c<'a'> > >("a \t\nb").pos == 4);
+
+  // test_whitespaces_at_the_end
+  BOOST_STATIC_ASSERT(parse<token<lit_c<'a'> > >("a  ").pos == 3);
+
+  // test_reject
+  BOOST_STATIC_ASSERT(!parse<token<lit_c<'a'> > >(" a").success);
+
+  // test_long_whitespace
+  BOOST_STATIC_ASSERT(parse<token<lit_c<'a'> > >("a" SPACES_4096).pos == 4097);
+  BOOST_STATIC_ASSERT(
+    parse<token<lit_c<'a'> > >("a" SPACES_4096 "b" SPACES_4096).pos == 4097
+  );
+}
+
+#undef SPACES_4096
+#undef SPACES_256
+#undef SPACES_16
+
+#endif
+
@@ -13,6 +13,9 @@
 #include "common.hpp"
 
 #include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/lambda.hpp>
 #include <boost/mpl/char.hpp>
 #include <boost/mpl/assert.hpp>
 
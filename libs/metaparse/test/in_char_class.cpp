@@ -0,0 +1,62 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/util/in_char_class.hpp>
+#include <mpllibs/metaparse/char_class.hpp>
+#include <mpllibs/metaparse/char_class_c.hpp>
+
+#include "common.hpp"
+
+#include <boost/mpl/apply.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/char.hpp>
+#include <boost/mpl/not.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_in_char_class)
+{
+  using mpllibs::metaparse::util::in_char_class;
+  using mpllibs::metaparse::char_class;
+  using mpllibs::metaparse::char_class_c;
+
+  using boost::mpl::apply;
+  using boost::mpl::char_;
+  using boost::mpl::not_;
+
+  typedef char_class_c<'a', 'h', '\t'> a_h_tab;
+
+  // test_member
+  BOOST_MPL_ASSERT((apply<in_char_class<a_h_tab>, char_a>));
+  BOOST_MPL_ASSERT((apply<in_char_class<a_h_tab>, char_h>));
+  BOOST_MPL_ASSERT((apply<in_char_class<a_h_tab>, char_tab>));
+
+  // test_non_member
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<a_h_tab>, char_b> >));
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<a_h_tab>, char_space> >));
+
+  // test_empty_class
+  BOOST_MPL_ASSERT((not_<apply<in_char_class<char_class<> >, char_a> >));
+
+  // test_first_and_last_bit_of_words
+  BOOST_MPL_ASSERT((
+    apply<in_char_class<char_class<0, 0, 0, 1> >, char_<char(96)> >
+  ));
+  BOOST_MPL_ASSERT((
+    apply<in_char_class<char_class<0, 0, 0, 0x80000000ul> >, char_<127> >
+  ));
+  BOOST_MPL_ASSERT((
+    not_<apply<in_char_class<char_class<0, 0, 0, 1> >, char_<97> > >
+  ));
+
+  // test_last_character
+  BOOST_MPL_ASSERT((
+    apply<
+      in_char_class<char_class<0, 0, 0, 0, 0, 0, 0, 0x80000000ul> >,
+      char_<char(255)>
+    >
+  ));
+}
+
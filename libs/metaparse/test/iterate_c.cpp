@@ -14,6 +14,8 @@
 #include <boost/mpl/equal_to.hpp>
 #include <boost/mpl/apply_wrap.hpp>
 #include <boost/mpl/equal.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/size.hpp>
 #include <boost/mpl/vector_c.hpp>
 #include <boost/mpl/assert.hpp>
 
@@ -70,4 +72,25 @@ BOOST_AUTO_TEST_CASE(test_iterate_c)
   ));
 }
 
+BOOST_AUTO_TEST_CASE(test_iterate_c_long_repetition)
+{
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::is_error;
+  using mpllibs::metaparse::iterate_c;
+  using mpllibs::metaparse::start;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::mpl::int_;
+  using boost::mpl::size;
+
+  typedef accept_until_col<1000> p;
+  typedef apply_wrap2<iterate_c<p, 1000>, str_, start> r;
+
+  // test_long_repetition
+  BOOST_MPL_ASSERT((equal_to<size<get_result<r>::type>::type, int_<1000> >));
+
+  // test_long_repetition_fails_at_the_end
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<iterate_c<p, 1001>, str_, start> >));
+}
 
@@ -0,0 +1,378 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/lalr_grammar.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/get_remaining.hpp>
+#include <mpllibs/metaparse/entire_input.hpp>
+#include <mpllibs/metaparse/get_col.hpp>
+#include <mpllibs/metaparse/get_position.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/one_char.hpp>
+#include <mpllibs/metaparse/sequence.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/equal.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/plus.hpp>
+#include <boost/mpl/minus.hpp>
+#include <boost/mpl/times.hpp>
+#include <boost/mpl/char.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/assert.hpp>
+
+using mpllibs::metaparse::string;
+
+using boost::mpl::at_c;
+
+namespace
+{
+  template <class V>
+  struct lazy_plus :
+    boost::mpl::plus<
+      typename at_c<typename V::type, 0>::type,
+      typename at_c<typename V::type, 2>::type
+    >
+  {};
+
+  template <class V>
+  struct lazy_minus :
+    boost::mpl::minus<
+      typename at_c<typename V::type, 0>::type,
+      typename at_c<typename V::type, 2>::type
+    >
+  {};
+
+  template <class V>
+  struct lazy_times :
+    boost::mpl::times<
+      typename at_c<typename V::type, 0>::type,
+      typename at_c<typename V::type, 2>::type
+    >
+  {};
+
+  // S ::= S '-' I
+  typedef
+    string<'S',' ',':',':','=',' ','S',' ','\'','-','\'',' ','I'>
+    left_recursive_minus;
+
+  // S ::= I '-' S
+  typedef
+    string<'S',' ',':',':','=',' ','I',' ','\'','-','\'',' ','S'>
+    right_recursive_minus;
+
+  // S ::= I
+  typedef string<'S',' ',':',':','=',' ','I'> s_is_int;
+
+  // E ::= I
+  typedef string<'E',' ',':',':','=',' ','I'> e_is_int;
+
+  // E ::= E '-' E
+  typedef
+    string<'E',' ',':',':','=',' ','E',' ','\'','-','\'',' ','E'>
+    ambiguous_minus;
+
+  // E ::= E '+' E | E '*' E
+  typedef
+    string<
+      'E',' ',':',':','=',' ','E',' ','\'','+','\'',' ','E',' ','|',' ',
+      'E',' ','\'','*','\'',' ','E'
+    >
+    ambiguous_plus_times;
+
+  // E ::= E '<' E | I
+  typedef
+    string<
+      'E',' ',':',':','=',' ','E',' ','\'','<','\'',' ','E',' ','|',' ','I'
+    >
+    ambiguous_less;
+
+  typedef string<'7','-','2','-','1'> seven_minus_two_minus_one;
+}
+
+BOOST_AUTO_TEST_CASE(test_lalr_grammar)
+{
+  using mpllibs::metaparse::lalr_grammar;
+  using mpllibs::metaparse::int_;
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::entire_input;
+  using mpllibs::metaparse::get_remaining;
+  using mpllibs::metaparse::get_col;
+  using mpllibs::metaparse::get_position;
+  using mpllibs::metaparse::lit_c;
+  using mpllibs::metaparse::one_char;
+  using mpllibs::metaparse::sequence;
+  using mpllibs::metaparse::start;
+  using mpllibs::metaparse::is_error;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::mpl::equal;
+  using boost::mpl::char_;
+  using boost::mpl::not_;
+  using boost::mpl::_1;
+
+  typedef
+    lalr_grammar<>
+      ::rule<string<'S',' ',':',':','=',' ','\'','x','\''> >::type
+    x_grammar;
+
+  // test_one_char
+  BOOST_MPL_ASSERT((
+    equal_to<
+      char_<'x'>,
+      get_result<apply_wrap2<x_grammar, string<'x'>, start> >::type
+    >
+  ));
+
+  // test_remaining_input
+  BOOST_MPL_ASSERT((
+    equal<
+      string<'y'>,
+      get_remaining<apply_wrap2<x_grammar, string<'x','y'>, start> >::type
+    >
+  ));
+
+  // test_used_in_sequence
+  BOOST_MPL_ASSERT((
+    not_<
+      is_error<
+        apply_wrap2<sequence<x_grammar, lit_c<'y'> >, string<'x','y'>, start>
+      >
+    >
+  ));
+
+  // test_reject_trailing_input_with_entire_input
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<entire_input<x_grammar>, string<'x','y'>, start> >
+  ));
+
+  // test_trailing_input_rejected_at_its_position
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<2>,
+      get_col<
+        get_position<
+          apply_wrap2<entire_input<x_grammar>, string<'x','y'>, start>
+        >
+      >::type
+    >
+  ));
+
+  // test_reject
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<x_grammar, string<'y'>, start> >));
+
+  // test_reject_empty_input
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<x_grammar, string<>, start> >));
+
+  // test_sequence_result
+  BOOST_MPL_ASSERT((
+    equal<
+      boost::mpl::vector<char_<'x'>, char_<'y'> >,
+      get_result<
+        apply_wrap2<
+          lalr_grammar<>
+            ::rule<
+              string<'S',' ',':',':','=',' ','\'','x','\'',' ','\'','y','\''>
+            >::type,
+          string<'x','y'>,
+          start
+        >
+      >::type
+    >
+  ));
+
+  // test_longest_terminal_is_used
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<12>,
+      get_result<
+        apply_wrap2<
+          lalr_grammar<>
+            ::import<string<'C'>, one_char>::type
+            ::import<string<'I'>, int_>::type
+            ::rule<string<'S',' ',':',':','=',' ','C',' ','|',' ','I'> >::type,
+          string<'1','2'>,
+          start
+        >
+      >::type
+    >
+  ));
+
+  // test_left_recursion
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<4>,
+      get_result<
+        apply_wrap2<
+          lalr_grammar<>
+            ::import<string<'I'>, int_>::type
+            ::rule<left_recursive_minus, lazy_minus<_1> >::type
+            ::rule<s_is_int>::type,
+          seven_minus_two_minus_one,
+          start
+        >
+      >::type
+    >
+  ));
+
+  // test_right_recursion
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<6>,
+      get_result<
+        apply_wrap2<
+          lalr_grammar<>
+            ::import<string<'I'>, int_>::type
+            ::rule<right_recursive_minus, lazy_minus<_1> >::type
+            ::rule<s_is_int>::type,
+          seven_minus_two_minus_one,
+          start
+        >
+      >::type
+    >
+  ));
+
+  typedef
+    lalr_grammar<string<'E'> >
+      ::import<string<'I'>, int_>::type
+      ::left<string<'\'','+','\''> >::type
+      ::left<string<'\'','*','\''> >::type
+      ::rule<ambiguous_plus_times, lazy_plus<_1> >::type
+      ::rule<e_is_int>::type
+    plus_grammar;
+
+  typedef
+    lalr_grammar<string<'E'> >
+      ::import<string<'I'>, int_>::type
+      ::left<string<'\'','+','\''> >::type
+      ::left<string<'\'','*','\''> >::type
+      ::rule<
+        string<'E',' ',':',':','=',' ','E',' ','\'','+','\'',' ','E'>,
+        lazy_plus<_1>
+      >::type
+      ::rule<
+        string<'E',' ',':',':','=',' ','E',' ','\'','*','\'',' ','E'>,
+        lazy_times<_1>
+      >::type
+      ::rule<e_is_int>::type
+    plus_times_grammar;
+
+  // test_precedence_of_the_first_operator
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<7>,
+      get_result<
+        apply_wrap2<plus_times_grammar, string<'1','+','2','*','3'>, start>
+      >::type
+    >
+  ));
+
+  // test_precedence_of_the_second_operator
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<7>,
+      get_result<
+        apply_wrap2<plus_times_grammar, string<'2','*','3','+','1'>, start>
+      >::type
+    >
+  ));
+
+  // test_alternatives_share_the_action
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<6>,
+      get_result<
+        apply_wrap2<plus_grammar, string<'1','+','2','*','3'>, start>
+      >::type
+    >
+  ));
+
+  // test_left_associativity
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<4>,
+      get_result<
+        apply_wrap2<
+          lalr_grammar<string<'E'> >
+            ::import<string<'I'>, int_>::type
+            ::left<string<'\'','-','\''> >::type
+            ::rule<ambiguous_minus, lazy_minus<_1> >::type
+            ::rule<e_is_int>::type,
+          seven_minus_two_minus_one,
+          start
+        >
+      >::type
+    >
+  ));
+
+  // test_right_associativity
+  BOOST_MPL_ASSERT((
+    equal_to<
+      boost::mpl::int_<6>,
+      get_result<
+        apply_wrap2<
+          lalr_grammar<string<'E'> >
+            ::import<string<'I'>, int_>::type
+            ::right<string<'\'','-','\''> >::type
+            ::rule<ambiguous_minus, lazy_minus<_1> >::type
+            ::rule<e_is_int>::type,
+          seven_minus_two_minus_one,
+          start
+        >
+      >::type
+    >
+  ));
+
+  typedef
+    lalr_grammar<string<'E'> >
+      ::import<string<'I'>, int_>::type
+      ::nonassoc<string<'\'','<','\''> >::type
+      ::rule<ambiguous_less>::type
+    less_grammar;
+
+  // test_nonassoc_accepts_one_operator
+  BOOST_MPL_ASSERT((
+    not_<is_error<apply_wrap2<less_grammar, string<'1','<','2'>, start> > >
+  ));
+
+  // test_nonassoc_rejects_chain
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<less_grammar, string<'1','<','2','<','3'>, start> >
+  ));
+
+  // The lookaheads of F ::= 'e' and E ::= 'e' after "a e" are different in
+  // LALR(1), but the same in SLR(1)
+  typedef
+    lalr_grammar<>
+      ::rule<
+        string<
+          'S',' ',':',':','=',' ','\'','a','\'',' ','E',' ','\'','c','\'',
+          ' ','|',' ','\'','a','\'',' ','F',' ','\'','d','\''
+        >
+      >::type
+      ::rule<string<'F',' ',':',':','=',' ','\'','e','\''> >::type
+      ::rule<string<'E',' ',':',':','=',' ','\'','e','\''> >::type
+    lookahead_grammar;
+
+  // test_lookahead_of_the_first_rule
+  BOOST_MPL_ASSERT((
+    not_<is_error<apply_wrap2<lookahead_grammar, string<'a','e','d'>, start> > >
+  ));
+
+  // test_lookahead_of_the_second_rule
+  BOOST_MPL_ASSERT((
+    not_<is_error<apply_wrap2<lookahead_grammar, string<'a','e','c'>, start> > >
+  ));
+}
+
@@ -0,0 +1,222 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/lexer.hpp>
+#include <mpllibs/metaparse/lex_rule.hpp>
+#include <mpllibs/metaparse/lex_skip.hpp>
+#include <mpllibs/metaparse/lexed.hpp>
+#include <mpllibs/metaparse/token_kind.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/letter.hpp>
+#include <mpllibs/metaparse/any1.hpp>
+#include <mpllibs/metaparse/spaces.hpp>
+#include <mpllibs/metaparse/keyword.hpp>
+#include <mpllibs/metaparse/sequence.hpp>
+#include <mpllibs/metaparse/foldlp.hpp>
+#include <mpllibs/metaparse/last_of.hpp>
+#include <mpllibs/metaparse/entire_input.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/get_position.hpp>
+#include <mpllibs/metaparse/get_col.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/plus.hpp>
+#include <boost/mpl/lambda.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/assert.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+using mpllibs::metaparse::lexer;
+using mpllibs::metaparse::lex_rule;
+using mpllibs::metaparse::lex_skip;
+using mpllibs::metaparse::string;
+
+namespace
+{
+  struct lexed_int;
+  struct lexed_plus;
+  struct lexed_if;
+  struct lexed_name;
+
+  typedef
+    lexer<
+      boost::mpl::vector<
+        lex_rule<
+          lexed_if,
+          mpllibs::metaparse::keyword<string<'i','f'> >
+        >,
+        lex_rule<
+          lexed_name,
+          mpllibs::metaparse::any1<mpllibs::metaparse::letter>
+        >,
+        lex_rule<lexed_int, mpllibs::metaparse::int_>,
+        lex_rule<lexed_plus, mpllibs::metaparse::lit_c<'+'> >,
+        lex_skip<mpllibs::metaparse::spaces>
+      >
+    >
+    sample_lexer;
+
+  template <class T>
+  struct token_col : mpllibs::metaparse::get_col<typename T::source_position>
+  {};
+}
+
+BOOST_AUTO_TEST_CASE(test_lexer)
+{
+  using mpllibs::metaparse::lexed;
+  using mpllibs::metaparse::token_kind;
+  using mpllibs::metaparse::sequence;
+  using mpllibs::metaparse::foldlp;
+  using mpllibs::metaparse::last_of;
+  using mpllibs::metaparse::entire_input;
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::get_position;
+  using mpllibs::metaparse::get_col;
+  using mpllibs::metaparse::start;
+  using mpllibs::metaparse::is_error;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::mpl::at_c;
+  using boost::mpl::size;
+  using boost::mpl::empty;
+  using boost::mpl::plus;
+  using boost::mpl::lambda;
+  using boost::mpl::int_;
+  using boost::mpl::_1;
+  using boost::mpl::_2;
+
+  using boost::is_same;
+
+  typedef
+    get_result<
+      apply_wrap2<sample_lexer, string<'1',' ','+',' ','2','3'>, start>
+    >::type
+    one_plus_twenty_three;
+
+  typedef
+    get_result<
+      apply_wrap2<sample_lexer, string<'i','f',' ','i','f','f','y'>, start>
+    >::type
+    if_iffy;
+
+  typedef token_kind<lexed_int> int_token;
+  typedef token_kind<lexed_plus> plus_token;
+
+  typedef
+    foldlp<
+      last_of<plus_token, int_token>,
+      int_token,
+      lambda<plus<_1, _2> >::type
+    >
+    sum;
+
+  // test_empty_input
+  BOOST_MPL_ASSERT((
+    empty<get_result<apply_wrap2<sample_lexer, string<>, start> >::type>
+  ));
+
+  // test_only_skipped_input
+  BOOST_MPL_ASSERT((
+    empty<get_result<apply_wrap2<sample_lexer, string<' ',' '>, start> >::type>
+  ));
+
+  // test_number_of_tokens
+  BOOST_MPL_ASSERT((equal_to<size<one_plus_twenty_three>::type, int_<3> >));
+
+  // test_token_kind
+  BOOST_MPL_ASSERT((
+    is_same<at_c<one_plus_twenty_three, 1>::type::kind, lexed_plus>
+  ));
+
+  // test_token_value
+  BOOST_MPL_ASSERT((
+    equal_to<at_c<one_plus_twenty_three, 2>::type::value, int_<23> >
+  ));
+
+  // test_token_position
+  BOOST_MPL_ASSERT((
+    equal_to<token_col<at_c<one_plus_twenty_three, 2>::type>::type, int_<5> >
+  ));
+
+  // test_first_rule_wins_on_same_length
+  BOOST_MPL_ASSERT((is_same<at_c<if_iffy, 0>::type::kind, lexed_if>));
+
+  // test_longest_match_wins
+  BOOST_MPL_ASSERT((is_same<at_c<if_iffy, 1>::type::kind, lexed_name>));
+
+  // test_no_rule_matches
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<sample_lexer, string<'1',' ','?'>, start> >
+  ));
+
+  // test_token_kind
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<
+        apply_wrap2<lexed<sample_lexer, int_token>, string<'1','3'>, start>
+      >::type,
+      int_<13>
+    >
+  ));
+
+  // test_token_kind_mismatch
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<lexed<sample_lexer, plus_token>, string<'1'>, start> >
+  ));
+
+  // test_token_kind_at_end_of_tokens
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<lexed<sample_lexer, int_token>, string<' '>, start> >
+  ));
+
+  // test_lexing_error
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<lexed<sample_lexer, int_token>, string<'?'>, start> >
+  ));
+
+  // test_combinators_on_tokens
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<
+        apply_wrap2<
+          lexed<sample_lexer, entire_input<sum> >,
+          string<'1',' ','+','2',' ','+',' ','3'>,
+          start
+        >
+      >::type,
+      int_<6>
+    >
+  ));
+
+  // test_error_position_is_source_position
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_col<
+        get_position<
+          apply_wrap2<
+            lexed<sample_lexer, sequence<int_token, plus_token> >,
+            string<'1',' ',' ','2'>,
+            start
+          >
+        >::type
+      >::type,
+      int_<4>
+    >
+  ));
+}
+
@@ -9,6 +9,12 @@
 #include <mpllibs/metaparse/is_error.hpp>
 #include <mpllibs/metaparse/start.hpp>
 #include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/get_col.hpp>
+#include <mpllibs/metaparse/get_message.hpp>
+#include <mpllibs/metaparse/get_position.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/sequence.hpp>
+#include <mpllibs/metaparse/error/literal_expected.hpp>
 
 #include "common.hpp"
 
@@ -16,6 +22,8 @@
 #include <boost/mpl/apply_wrap.hpp>
 #include <boost/mpl/assert.hpp>
 
+#include <boost/type_traits/is_same.hpp>
+
 #include <boost/test/unit_test.hpp>
 
 BOOST_AUTO_TEST_CASE(test_one_of)
@@ -136,4 +144,87 @@ BOOST_AUTO_TEST_CASE(test_one_of)
   ));
 }
 
+namespace
+{
+  struct message_without_text {};
+}
+
+BOOST_AUTO_TEST_CASE(test_one_of_furthest_failure)
+{
+  using mpllibs::metaparse::error::literal_expected;
+  using mpllibs::metaparse::fail;
+  using mpllibs::metaparse::get_col;
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::one_char;
+  using mpllibs::metaparse::get_message;
+  using mpllibs::metaparse::get_position;
+  using mpllibs::metaparse::lit_c;
+  using mpllibs::metaparse::one_of;
+  using mpllibs::metaparse::sequence;
+  using mpllibs::metaparse::start;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::is_same;
+
+  typedef sequence<lit_c<'h'>, lit_c<'x'> > hx;
+
+  typedef apply_wrap2<one_of<hx, lit_c<'a'> >, str_hello, start> further1;
+  typedef apply_wrap2<one_of<lit_c<'a'>, hx>, str_hello, start> further2;
+  typedef apply_wrap2<one_of<lit_c<'a'>, lit_c<'b'> >, str_hello, start> same;
+  typedef
+    apply_wrap2<
+      one_of<one_of<lit_c<'a'>, lit_c<'b'> >, lit_c<'b'>, lit_c<'c'> >,
+      str_hello,
+      start
+    >
+    nested;
+
+  // test_error_of_first_parser_reaching_further
+  BOOST_MPL_ASSERT((equal_to<get_col<get_position<further1> >::type, int2>));
+  BOOST_MPL_ASSERT((
+    is_same<get_message<further1>::type, literal_expected<char_x> >
+  ));
+
+  // test_error_of_second_parser_reaching_further
+  BOOST_MPL_ASSERT((equal_to<get_col<get_position<further2> >::type, int2>));
+  BOOST_MPL_ASSERT((
+    is_same<get_message<further2>::type, literal_expected<char_x> >
+  ));
+
+  // test_errors_at_the_same_position
+  BOOST_MPL_ASSERT((equal_to<get_col<get_position<same> >::type, int1>));
+  BOOST_CHECK_EQUAL(
+    "None of the expected cases found: Expected: a; Expected: b",
+    get_message<same>::type::get_value()
+  );
+
+  // test_errors_of_nested_one_of
+  BOOST_CHECK_EQUAL(
+    "None of the expected cases found: Expected: a; Expected: b; Expected: c",
+    get_message<nested>::type::get_value()
+  );
+
+  // test_errors_without_text_at_the_same_position
+  typedef fail<message_without_text> fail_without_text;
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<
+        apply_wrap2<
+          one_of<fail_without_text, lit_c<'a'>, one_char>,
+          str_hello,
+          start
+        >
+      >::type,
+      char_h
+    >
+  ));
+  typedef
+    apply_wrap2<one_of<fail_without_text, lit_c<'a'> >, str_hello, start>
+    without_text;
+  BOOST_CHECK_EQUAL(
+    "None of the expected cases found: Unknown error; Expected: a",
+    get_message<without_text>::type::get_value()
+  );
+}
 
@@ -0,0 +1,198 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/operator_precedence.hpp>
+#include <mpllibs/metaparse/infix_left_op.hpp>
+#include <mpllibs/metaparse/infix_right_op.hpp>
+#include <mpllibs/metaparse/prefix_op.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/get_remaining.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/equal.hpp>
+#include <boost/mpl/plus.hpp>
+#include <boost/mpl/minus.hpp>
+#include <boost/mpl/times.hpp>
+#include <boost/mpl/negate.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/assert.hpp>
+
+namespace
+{
+  struct precedence_plus
+  {
+    typedef precedence_plus type;
+
+    template <class A, class B>
+    struct apply : boost::mpl::plus<A, B> {};
+  };
+
+  struct precedence_minus
+  {
+    typedef precedence_minus type;
+
+    template <class A, class B>
+    struct apply : boost::mpl::minus<A, B> {};
+  };
+
+  struct precedence_times
+  {
+    typedef precedence_times type;
+
+    template <class A, class B>
+    struct apply : boost::mpl::times<A, B> {};
+  };
+
+  struct precedence_negate
+  {
+    typedef precedence_negate type;
+
+    template <class A>
+    struct apply : boost::mpl::negate<A> {};
+  };
+}
+
+BOOST_AUTO_TEST_CASE(test_operator_precedence)
+{
+  using mpllibs::metaparse::operator_precedence;
+  using mpllibs::metaparse::infix_left_op;
+  using mpllibs::metaparse::infix_right_op;
+  using mpllibs::metaparse::prefix_op;
+  using mpllibs::metaparse::lit_c;
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::get_remaining;
+  using mpllibs::metaparse::start;
+  using mpllibs::metaparse::is_error;
+  using mpllibs::metaparse::string;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal_to;
+  using boost::mpl::equal;
+  using boost::mpl::vector;
+  using boost::mpl::int_;
+
+  typedef
+    operator_precedence<
+      mpllibs::metaparse::int_,
+      vector<
+        infix_left_op<lit_c<'+'>, int_<1>, precedence_plus>,
+        infix_left_op<lit_c<'-'>, int_<1>, precedence_minus>,
+        infix_left_op<lit_c<'*'>, int_<2>, precedence_times>,
+        infix_right_op<lit_c<'^'>, int_<3>, precedence_minus>,
+        prefix_op<lit_c<'-'>, int_<4>, precedence_negate>
+      >
+    >
+    p;
+
+  // test_atom
+  BOOST_MPL_ASSERT((
+    equal_to<get_result<apply_wrap2<p, string<'1','3'>, start> >::type, int_<13> >
+  ));
+
+  // test_no_atom
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<p, string<>, start> >));
+
+  // test_infix_without_lhs
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<p, string<'+','1'>, start> >));
+
+  // test_left_associative
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<p, string<'7','-','2','-','1'>, start> >::type,
+      int_<4>
+    >
+  ));
+
+  // test_right_associative
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<p, string<'7','^','2','^','1'>, start> >::type,
+      int_<6>
+    >
+  ));
+
+  // test_higher_power_on_the_right
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<p, string<'1','+','2','*','3'>, start> >::type,
+      int_<7>
+    >
+  ));
+
+  // test_higher_power_on_the_left
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<p, string<'2','*','3','+','1'>, start> >::type,
+      int_<7>
+    >
+  ));
+
+  // test_mixed_powers
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<
+        apply_wrap2<
+          p,
+          string<'1','+','2','*','3','^','1','*','2','-','1'>,
+          start
+        >
+      >::type,
+      int_<8>
+    >
+  ));
+
+  // test_prefix
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<p, string<'-','2','*','3'>, start> >::type,
+      int_<-6>
+    >
+  ));
+
+  // test_prefix_after_infix
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<p, string<'7','-','-','2'>, start> >::type,
+      int_<9>
+    >
+  ));
+
+  // test_remaining_input
+  BOOST_MPL_ASSERT((
+    equal<
+      get_remaining<apply_wrap2<p, string<'1','+','2',')'>, start> >::type,
+      string<')'>
+    >
+  ));
+
+  // test_missing_rhs
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_result<apply_wrap2<p, string<'1','+'>, start> >::type,
+      int_<1>
+    >
+  ));
+
+  // test_operator_of_missing_rhs_is_not_consumed
+  BOOST_MPL_ASSERT((
+    equal<
+      get_remaining<apply_wrap2<p, string<'1','+'>, start> >::type,
+      string<'+'>
+    >
+  ));
+
+  // test_missing_operand_of_prefix
+  BOOST_MPL_ASSERT((is_error<apply_wrap2<p, string<'-'>, start> >));
+}
+
@@ -0,0 +1,135 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/regex.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/get_remaining.hpp>
+#include <mpllibs/metaparse/get_col.hpp>
+#include <mpllibs/metaparse/get_position.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/equal.hpp>
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/assert.hpp>
+
+namespace
+{
+  // [a-z_][a-z0-9_]*
+  typedef
+    mpllibs::metaparse::string<
+      '[','a','-','z','_',']','[','a','-','z','0','-','9','_',']','*'
+    >
+    regex_identifier;
+
+  // a(b|c)*
+  typedef
+    mpllibs::metaparse::string<'a','(','b','|','c',')','*'>
+    regex_a_bc_star;
+}
+
+BOOST_AUTO_TEST_CASE(test_regex)
+{
+  using mpllibs::metaparse::regex;
+  using mpllibs::metaparse::is_error;
+  using mpllibs::metaparse::start;
+  using mpllibs::metaparse::get_result;
+  using mpllibs::metaparse::get_remaining;
+  using mpllibs::metaparse::get_col;
+  using mpllibs::metaparse::get_position;
+  using mpllibs::metaparse::string;
+
+  using boost::mpl::apply_wrap2;
+  using boost::mpl::equal;
+  using boost::mpl::equal_to;
+  using boost::mpl::int_;
+
+  typedef string<'f','o','o','_','1','+','x'> foo_1_plus_x;
+
+  // test_longest_prefix_is_accepted
+  BOOST_MPL_ASSERT((
+    equal<
+      get_result<apply_wrap2<regex<regex_identifier>, foo_1_plus_x, start> >
+        ::type,
+      string<'f','o','o','_','1'>
+    >
+  ));
+
+  // test_remaining_input
+  BOOST_MPL_ASSERT((
+    equal<
+      get_remaining<
+        apply_wrap2<regex<regex_identifier>, foo_1_plus_x, start>
+      >::type,
+      string<'+','x'>
+    >
+  ));
+
+  // test_position_after_match
+  BOOST_MPL_ASSERT((
+    equal_to<
+      get_col<
+        get_position<
+          apply_wrap2<regex<regex_identifier>, foo_1_plus_x, start>
+        >::type
+      >::type,
+      int_<6>
+    >
+  ));
+
+  // test_no_match
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<regex<regex_identifier>, string<'1','a'>, start> >
+  ));
+
+  // test_empty_input
+  BOOST_MPL_ASSERT((
+    is_error<apply_wrap2<regex<regex_identifier>, string<>, start> >
+  ));
+
+  // test_backtracking_to_last_accepting_state
+  BOOST_MPL_ASSERT((
+    equal<
+      get_result<
+        apply_wrap2<
+          regex<string<'a','b','c','|','a'> >,
+          string<'a','b','x'>,
+          start
+        >
+      >::type,
+      string<'a'>
+    >
+  ));
+
+  // test_alternative_and_repetition
+  BOOST_MPL_ASSERT((
+    equal<
+      get_result<
+        apply_wrap2<
+          regex<regex_a_bc_star>,
+          string<'a','b','c','c','b','d'>,
+          start
+        >
+      >::type,
+      string<'a','b','c','c','b'>
+    >
+  ));
+
+  // test_regex_accepting_empty_string
+  BOOST_MPL_ASSERT((
+    equal<
+      get_result<
+        apply_wrap2<regex<string<'x','*'> >, string<'y'>, start>
+      >::type,
+      string<>
+    >
+  ));
+}
+
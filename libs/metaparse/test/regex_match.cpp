@@ -0,0 +1,64 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/regex_match.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/assert.hpp>
+
+BOOST_AUTO_TEST_CASE(test_regex_match)
+{
+  using mpllibs::metaparse::regex_match;
+  using mpllibs::metaparse::string;
+
+  using boost::mpl::not_;
+
+  // a(b|c)*d
+  typedef string<'a','(','b','|','c',')','*','d'> abcd;
+
+  // \d+(\.\d*)?
+  typedef
+    string<'\\','d','+','(','\\','.','\\','d','*',')','?'>
+    number;
+
+  // test_match
+  BOOST_MPL_ASSERT((regex_match<abcd, string<'a','b','c','b','d'> >));
+
+  // test_match_without_repetition
+  BOOST_MPL_ASSERT((regex_match<abcd, string<'a','d'> >));
+
+  // test_prefix_does_not_match
+  BOOST_MPL_ASSERT((not_<regex_match<abcd, string<'a','b','c'> > >));
+
+  // test_unexpected_character
+  BOOST_MPL_ASSERT((not_<regex_match<abcd, string<'a','x','d'> > >));
+
+  // test_empty_string
+  BOOST_MPL_ASSERT((not_<regex_match<abcd, string<> > >));
+
+  // test_empty_regex
+  BOOST_MPL_ASSERT((regex_match<string<>, string<> >));
+
+  // test_escapes_and_optional
+  BOOST_MPL_ASSERT((regex_match<number, string<'3','.','1','4'> >));
+  BOOST_MPL_ASSERT((regex_match<number, string<'4','2'> >));
+  BOOST_MPL_ASSERT((not_<regex_match<number, string<'.','5'> > >));
+
+  // test_negated_bracket
+  BOOST_MPL_ASSERT((
+    regex_match<string<'[','^','0','-','9',']','+'>, string<'a','b'> >
+  ));
+  BOOST_MPL_ASSERT((
+    not_<regex_match<string<'[','^','0','-','9',']','+'>, string<'a','1'> > >
+  ));
+
+  // test_dot_does_not_match_new_line
+  BOOST_MPL_ASSERT((regex_match<string<'.'>, string<'x'> >));
+  BOOST_MPL_ASSERT((not_<regex_match<string<'.'>, string<'\n'> > >));
+}
+
@@ -0,0 +1,51 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/regex_matcher.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+BOOST_AUTO_TEST_CASE(test_regex_matcher)
+{
+  using mpllibs::metaparse::regex_matcher;
+  using mpllibs::metaparse::string;
+
+  // [a-z_][a-z0-9_]*
+  typedef
+    regex_matcher<
+      string<'[','a','-','z','_',']','[','a','-','z','0','-','9','_',']','*'>
+    >
+    identifier;
+
+  // x?
+  typedef regex_matcher<string<'x','?'> > optional_x;
+
+  const char with_zero[] = {'a', '\0', 'b'};
+
+  // test_match
+  BOOST_CHECK(identifier::match("foo_1"));
+
+  // test_no_match
+  BOOST_CHECK(!identifier::match("1foo"));
+  BOOST_CHECK(!identifier::match("foo bar"));
+
+  // test_match_std_string
+  BOOST_CHECK(identifier::match(std::string("x_9")));
+
+  // test_match_range
+  BOOST_CHECK(identifier::match(with_zero, with_zero + 1));
+  BOOST_CHECK(!identifier::match(with_zero, with_zero + 3));
+
+  // test_match_empty_string
+  BOOST_CHECK(optional_x::match(""));
+  BOOST_CHECK(!identifier::match(""));
+
+  // test_characters_outside_ascii
+  BOOST_CHECK(!identifier::match("a\xe9"));
+}
+
@@ -79,6 +79,9 @@ BOOST_AUTO_TEST_CASE(test_string)
   // test_value
   BOOST_REQUIRE_EQUAL(std::string("Hello"), c_str<hello>::type::value);
 
+  // test_value_is_zero_terminated
+  BOOST_REQUIRE_EQUAL('\0', c_str<hello>::type::value[5]);
+
   // equal_to
   BOOST_MPL_ASSERT((equal_to<hello, hello>));
   BOOST_MPL_ASSERT_NOT((equal_to<hello, empty_string>));
@@ -0,0 +1,89 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/debug_parsing_error.hpp>
+#include <mpllibs/metaparse/build_parser.hpp>
+#include <mpllibs/metaparse/sequence.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+
+using mpllibs::metaparse::debug_parsing_error;
+using mpllibs::metaparse::build_parser;
+using mpllibs::metaparse::sequence;
+using mpllibs::metaparse::lit_c;
+using mpllibs::metaparse::string;
+
+namespace
+{
+  typedef sequence<lit_c<'a'>, lit_c<'b'> > debug_ab;
+
+  template <class P, class S>
+  std::string debug_report()
+  {
+    std::ostringstream s;
+    debug_parsing_error<P, S> d(s);
+    return s.str();
+  }
+
+  bool contains(const std::string& s_, const std::string& part_)
+  {
+    return s_.find(part_) != std::string::npos;
+  }
+
+  int count(const std::string& s_, const std::string& part_)
+  {
+    int n = 0;
+    for (
+      std::string::size_type i = s_.find(part_);
+      i != std::string::npos;
+      i = s_.find(part_, i + 1)
+    )
+    {
+      ++n;
+    }
+    return n;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_debug_parsing_error)
+{
+  const std::string ac = debug_report<debug_ab, string<'a', 'c'> >();
+
+  // test_input_is_displayed
+  BOOST_CHECK(contains(ac, "Input text:\nac\n"));
+
+  // test_error_is_displayed
+  BOOST_CHECK(contains(ac, "Parsing failed:\nline 1, col 2: "));
+
+  // test_parser_application_is_displayed
+  BOOST_CHECK(contains(ac, "line 1, col 1 - line 1, col 2: rejected "));
+
+  // test_success_is_displayed
+  BOOST_CHECK(
+    contains(
+      debug_report<debug_ab, string<'a', 'b', 'x'> >(),
+      "Parsing was successful. Remaining string is:\nx\n"
+    )
+  );
+
+  // test_build_parser_is_debugged
+  BOOST_CHECK(
+    contains(
+      debug_report<build_parser<debug_ab>, string<'a', 'c'> >(),
+      "Parsing failed:\nline 1, col 2: "
+    )
+  );
+
+  // test_applications_on_other_inputs_are_not_displayed
+  const std::string bac = debug_report<debug_ab, string<'b', 'a', 'c'> >();
+  BOOST_CHECK_EQUAL(1, count(bac, "sequence"));
+  BOOST_CHECK(contains(bac, "line 1, col 1 - line 1, col 1: rejected "));
+}
+
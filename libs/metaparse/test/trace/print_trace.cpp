@@ -0,0 +1,74 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/print_trace.hpp>
+#include <mpllibs/metaparse/one_of.hpp>
+#include <mpllibs/metaparse/lit_c.hpp>
+#include <mpllibs/metaparse/start.hpp>
+
+#include "../common.hpp"
+
+#include <boost/mpl/apply_wrap.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <typeinfo>
+
+using mpllibs::metaparse::v1::impl::one_of_2;
+using mpllibs::metaparse::lit_c;
+using mpllibs::metaparse::start;
+
+using boost::mpl::apply_wrap2;
+
+namespace
+{
+  typedef one_of_2<lit_c<'a'>, lit_c<'b'> > a_or_b;
+
+  // Parsing happens at compile-time, the records are added at startup
+  typedef apply_wrap2<a_or_b, str_b, start>::type accepted;
+  typedef apply_wrap2<a_or_b, str_c, start>::type rejected;
+
+  template <class P>
+  int count_records(bool success_)
+  {
+    using mpllibs::metaparse::v1::impl::trace_entry;
+    using mpllibs::metaparse::v1::impl::trace_log;
+
+    int n = 0;
+    for (
+      std::vector<trace_entry>::const_iterator
+        i = trace_log().begin(),
+        e = trace_log().end();
+      i != e;
+      ++i
+    )
+    {
+      if (*i->parser == typeid(P) && i->success == success_)
+      {
+        ++n;
+      }
+    }
+    return n;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_print_trace)
+{
+  using mpllibs::metaparse::print_trace;
+
+  // test_accepting_application_is_recorded
+  BOOST_CHECK_EQUAL(1, count_records<a_or_b>(true));
+
+  // test_rejecting_application_is_recorded
+  BOOST_CHECK_EQUAL(1, count_records<a_or_b>(false));
+
+  // test_histogram_contains_parser
+  std::ostringstream s;
+  print_trace(s);
+  BOOST_CHECK(s.str().find("one_of_2") != std::string::npos);
+}
+
@@ -5,8 +5,12 @@
 
 // No include guards to make it possible to include it multiple times
 
+#include <mpllibs/safe_printf/bounded_sprintf.hpp>
+#include <mpllibs/safe_printf/buffer.hpp>
 #include <mpllibs/safe_printf/error.hpp>
 #include <mpllibs/safe_printf/expected_types.hpp>
+#include <mpllibs/safe_printf/format_to.hpp>
+#include <mpllibs/safe_printf/max_length.hpp>
 #include <mpllibs/safe_printf/printf.hpp>
 #include <mpllibs/safe_printf/printf_max_argument.hpp>
 #include <mpllibs/safe_printf/valid_arguments.hpp>
@@ -0,0 +1,52 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/bounded_sprintf.hpp>
+#include <mpllibs/safe_printf/buffer.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <climits>
+#include <limits>
+#include <string>
+
+using mpllibs::safe_printf::bounded_sprintf;
+using mpllibs::safe_printf::buffer;
+
+using mpllibs::metaparse::string;
+
+BOOST_AUTO_TEST_CASE(test_bounded_sprintf)
+{
+  typedef string<'%','d',' ','%','.','3','s'> format;
+
+  const buffer<format> b = bounded_sprintf<format>(-12, "hello");
+
+  // Check the output
+  BOOST_CHECK_EQUAL(std::string("-12 hel"), b.c_str());
+  BOOST_CHECK_EQUAL(7, b.size());
+
+  // Check the capacity
+  BOOST_CHECK_EQUAL(11 + 1 + 3 + 1, buffer<format>::capacity);
+}
+
+BOOST_AUTO_TEST_CASE(test_bounded_sprintf_longest_output)
+{
+  typedef string<'[','%','l','d',']'> format;
+
+  const buffer<format> b =
+    bounded_sprintf<format>(std::numeric_limits<long int>::min());
+
+  // Check that the longest output fits in the buffer
+  BOOST_CHECK_LT(b.size(), int(buffer<format>::capacity));
+}
+
+BOOST_AUTO_TEST_CASE(test_bounded_sprintf_no_argument)
+{
+  typedef string<'1','0','0','%','%'> format;
+
+  // Check format string with no placeholders
+  BOOST_CHECK_EQUAL(std::string("100%"), bounded_sprintf<format>().c_str());
+}
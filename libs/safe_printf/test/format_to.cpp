@@ -0,0 +1,227 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/format_to.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/mpl/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+using mpllibs::safe_printf::format_to;
+using mpllibs::safe_printf::format;
+
+using mpllibs::metaparse::string;
+
+BOOST_AUTO_TEST_CASE(test_format_to_string)
+{
+  typedef string<'%','d',' ','%','c'> format_string;
+
+  std::string s("x=");
+  const int len = format_to<format_string>(s, 42, 'a');
+
+  // Check that the output is appended
+  BOOST_CHECK_EQUAL("x=42 a", s);
+  BOOST_CHECK_EQUAL(4, len);
+}
+
+BOOST_AUTO_TEST_CASE(test_format_to_vector)
+{
+  typedef string<'[','%','.','2','s',']'> format_string;
+
+  std::vector<char> v;
+  format_to<format_string>(v, "hello");
+  format_to<format_string>(v, "world");
+
+  // Check that the output is appended without the terminating '\0'
+  BOOST_CHECK_EQUAL("[he][wo]", std::string(v.begin(), v.end()));
+}
+
+BOOST_AUTO_TEST_CASE(test_format_to_unknown_length)
+{
+  typedef string<'%','s','/','%','*','d'> format_string;
+
+  std::string s;
+  const int len = format_to<format_string>(s, "hello", 5, 12);
+
+  // Check format string the output length of which is not known at compile
+  // time
+  BOOST_CHECK_EQUAL("hello/   12", s);
+  BOOST_CHECK_EQUAL(11, len);
+}
+
+BOOST_AUTO_TEST_CASE(test_format)
+{
+  typedef string<'%','d','%','%'> format_string;
+
+  BOOST_CHECK_EQUAL("100%", format<format_string>(100));
+}
+
+BOOST_AUTO_TEST_CASE(test_format_no_argument)
+{
+  typedef string<'H','e','l','l','o'> format_string;
+
+  BOOST_CHECK_EQUAL("Hello", format<format_string>());
+}
+
+BOOST_AUTO_TEST_CASE(test_format_integers)
+{
+  typedef MPLLIBS_STRING("[%+5d|%-6i|% d|%05d|%.3d|%.0d]") signed_format;
+  typedef MPLLIBS_STRING("[%#o|%#x|%#X|%-#8.3x]") alternate_format;
+  typedef MPLLIBS_STRING("[%08u|%.0o|%#.0o]") unsigned_format;
+  typedef MPLLIBS_STRING("[%hd|%hu|%hx|%ho]") short_format;
+
+  BOOST_CHECK_EQUAL(
+    "[  +42|-42   | 7|-0013|005|]",
+    format<signed_format>(42, -42, 7, -13, 5, 0)
+  );
+  BOOST_CHECK_EQUAL(
+    "[017|0xff|0XFF|0x00a   ]",
+    format<alternate_format>(15, 255u, 255u, 10u)
+  );
+  BOOST_CHECK_EQUAL("[00000042||0]", format<unsigned_format>(42u, 0, 0));
+  BOOST_CHECK_EQUAL(
+    "[-3|65535|ffff|177777]",
+    format<short_format>(
+      short(-3),
+      static_cast<unsigned short>(65535),
+      static_cast<unsigned short>(65535),
+      short(-1)
+    )
+  );
+}
+
+BOOST_AUTO_TEST_CASE(test_format_long_integers)
+{
+  typedef MPLLIBS_STRING("[%ld|%lu|%lx|%lo|%o]") long_format;
+
+  const long min = std::numeric_limits<long>::min();
+  const unsigned long max = std::numeric_limits<unsigned long>::max();
+
+  char expected[128];
+  std::sprintf(
+    expected,
+    boost::mpl::c_str<long_format>::type::value,
+    min,
+    max,
+    max,
+    -1l,
+    -1
+  );
+
+  // Check the limits of the types against the C library
+  BOOST_CHECK_EQUAL(expected, format<long_format>(min, max, max, -1l, -1));
+}
+
+BOOST_AUTO_TEST_CASE(test_format_characters_and_strings)
+{
+  typedef MPLLIBS_STRING("[%c|%-3c|%3c]") char_format;
+  typedef MPLLIBS_STRING("[%s|%-7s|%7.3s|%.*s|%*s]") string_format;
+
+  const char text[] = {'a', 'b', 'c', 'd'};
+
+  BOOST_CHECK_EQUAL("[a|b  |  c]", format<char_format>('a', 'b', 'c'));
+
+  // Check that the precision stops reading the not terminated text
+  BOOST_CHECK_EQUAL(
+    "[hello|hello  |    hel|ab| hi]",
+    format<string_format>("hello", "hello", "hello", 2, text, 3, "hi")
+  );
+}
+
+BOOST_AUTO_TEST_CASE(test_format_wide_characters)
+{
+  typedef MPLLIBS_STRING("[%lc|%ls|%5.2ls]") wide_format;
+
+  BOOST_CHECK_EQUAL(
+    "[a|hello|   he]",
+    format<wide_format>(L'a', L"hello", L"hello")
+  );
+}
+
+BOOST_AUTO_TEST_CASE(test_format_floating_point)
+{
+  typedef MPLLIBS_STRING("[%f|%-12.3e|%+G|%#.0f|%010.2f]") float_format;
+  typedef MPLLIBS_STRING("[%Lf|%Lg]") long_double_format;
+
+  char expected[256];
+  std::sprintf(
+    expected,
+    boost::mpl::c_str<float_format>::type::value,
+    3.25,
+    -1234.5,
+    0.0001,
+    2.0,
+    -3.14159
+  );
+
+  // Check the conversions formatted by the C library
+  BOOST_CHECK_EQUAL(
+    expected,
+    format<float_format>(3.25, -1234.5, 0.0001, 2.0, -3.14159)
+  );
+
+  std::sprintf(
+    expected,
+    boost::mpl::c_str<long_double_format>::type::value,
+    1e100l,
+    0.5l
+  );
+  BOOST_CHECK_EQUAL(expected, format<long_double_format>(1e100l, 0.5l));
+}
+
+BOOST_AUTO_TEST_CASE(test_format_floating_point_with_runtime_precision)
+{
+  typedef MPLLIBS_STRING("%.*f|%*.1e") float_format;
+
+  char expected[512];
+  std::sprintf(
+    expected,
+    boost::mpl::c_str<float_format>::type::value,
+    300,
+    1.0 / 3,
+    200,
+    2.5
+  );
+
+  // Check the output longer than the buffer on the stack
+  BOOST_CHECK_EQUAL(expected, format<float_format>(300, 1.0 / 3, 200, 2.5));
+}
+
+BOOST_AUTO_TEST_CASE(test_format_pointer)
+{
+  typedef MPLLIBS_STRING("%p") pointer_format;
+
+  int i = 0;
+  char expected[64];
+  std::sprintf(expected, "%p", static_cast<void*>(&i));
+
+  BOOST_CHECK_EQUAL(expected, format<pointer_format>(&i));
+}
+
+BOOST_AUTO_TEST_CASE(test_format_number_of_characters)
+{
+  typedef MPLLIBS_STRING("abc%d%n") count_format;
+
+  std::string s("x");
+  int n = 0;
+  format_to<count_format>(s, 42, &n);
+
+  // Check that the characters of the container before are not counted
+  BOOST_CHECK_EQUAL(5, n);
+}
+
+BOOST_AUTO_TEST_CASE(test_format_arguments_of_width_and_precision)
+{
+  typedef MPLLIBS_STRING("%%%*.*d%%|%*d") star_format;
+
+  // Check that a negative width left-justifies the conversion
+  BOOST_CHECK_EQUAL("%007  %|  1", format<star_format>(-5, 3, 7, 3, 1));
+}
@@ -0,0 +1,145 @@
+// Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/max_length.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/equal_to.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/assert.hpp>
+
+#include <climits>
+#include <cstdio>
+#include <limits>
+
+using mpllibs::safe_printf::max_length;
+
+using boost::mpl::equal_to;
+using boost::mpl::int_;
+using mpllibs::metaparse::string;
+
+BOOST_AUTO_TEST_CASE(test_max_length)
+{
+  // Check empty format string
+  BOOST_MPL_ASSERT((equal_to<max_length<string<> >::type, int_<0> >));
+
+  // Check format string with no placeholders
+  BOOST_MPL_ASSERT((
+    equal_to<max_length<string<'H','e','l','l','o'> >::type, int_<5> >
+  ));
+
+  // Check double percent char
+  BOOST_MPL_ASSERT((equal_to<max_length<string<'%','%'> >::type, int_<1> >));
+
+  // Check characters around a placeholder
+  BOOST_MPL_ASSERT((
+    equal_to<max_length<string<'a','%','c','b'> >::type, int_<3> >
+  ));
+
+  // Check placeholder with width
+  BOOST_MPL_ASSERT((
+    equal_to<max_length<string<'%','-','1','0','c'> >::type, int_<10> >
+  ));
+
+  // Check string placeholder with precision
+  BOOST_MPL_ASSERT((
+    equal_to<max_length<string<'%','.','1','2','s'> >::type, int_<12> >
+  ));
+
+  // Check integer placeholder with precision
+  BOOST_MPL_ASSERT((
+    equal_to<max_length<string<'%','.','4','0','d'> >::type, int_<41> >
+  ));
+
+  // Check two placeholders
+  BOOST_MPL_ASSERT((
+    equal_to<
+      max_length<string<'%','5','c',' ','%','.','3','s'> >::type,
+      int_<9>
+    >
+  ));
+}
+
+BOOST_AUTO_TEST_CASE(test_max_length_of_numbers)
+{
+  char s[512];
+
+  // Check the longest int
+  typedef string<'%','d'> format1;
+  BOOST_CHECK_GE(
+    max_length<format1>::type::value,
+    std::sprintf(s, "%d", std::numeric_limits<int>::min())
+  );
+
+  // Check the longest long int
+  typedef string<'%','l','i'> format2;
+  BOOST_CHECK_GE(
+    max_length<format2>::type::value,
+    std::sprintf(s, "%li", std::numeric_limits<long int>::min())
+  );
+
+  // Check the longest short int
+  typedef string<'%','h','d'> format3;
+  BOOST_CHECK_GE(
+    max_length<format3>::type::value,
+    std::sprintf(s, "%hd", std::numeric_limits<short int>::min())
+  );
+
+  // Check the longest unsigned long int
+  typedef string<'%','l','u'> format4;
+  BOOST_CHECK_GE(
+    max_length<format4>::type::value,
+    std::sprintf(s, "%lu", std::numeric_limits<long unsigned int>::max())
+  );
+
+  // Check the longest octal unsigned int
+  typedef string<'%','#','o'> format5;
+  BOOST_CHECK_GE(
+    max_length<format5>::type::value,
+    std::sprintf(s, "%#o", std::numeric_limits<unsigned int>::max())
+  );
+
+  // Check the longest hexadecimal unsigned int
+  typedef string<'%','#','x'> format6;
+  BOOST_CHECK_GE(
+    max_length<format6>::type::value,
+    std::sprintf(s, "%#x", std::numeric_limits<unsigned int>::max())
+  );
+
+  // Check the longest double in fixed notation
+  typedef string<'%','f'> format7;
+  BOOST_CHECK_GE(
+    max_length<format7>::type::value,
+    std::sprintf(s, "%f", -std::numeric_limits<double>::max())
+  );
+
+  // Check the longest double in exponent notation
+  typedef string<'%','e'> format8;
+  BOOST_CHECK_GE(
+    max_length<format8>::type::value,
+    std::sprintf(s, "%e", -std::numeric_limits<double>::min())
+  );
+
+  // Check the longest double in general notation
+  typedef string<'%','#','g'> format9;
+  BOOST_CHECK_GE(
+    max_length<format9>::type::value,
+    std::sprintf(s, "%#g", -0.0001234567)
+  );
+  typedef string<'%','g'> format10;
+  BOOST_CHECK_GE(
+    max_length<format10>::type::value,
+    std::sprintf(s, "%g", -std::numeric_limits<double>::min())
+  );
+
+  // Check the longest pointer
+  typedef string<'%','p'> format11;
+  BOOST_CHECK_GE(
+    max_length<format11>::type::value,
+    std::sprintf(s, "%p", static_cast<void*>(0))
+  );
+}
@@ -0,0 +1,12 @@
+#ifndef MPLLIBS_METAMONAD_ALGEBRAIC_DATA_TYPE_TAG_MPL_HPP
+#define MPLLIBS_METAMONAD_ALGEBRAIC_DATA_TYPE_TAG_MPL_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/algebraic_data_type_tag_mpl.hpp>
+
+#endif
+
@@ -0,0 +1,20 @@
+#ifndef MPLLIBS_METAMONAD_DICT_HPP
+#define MPLLIBS_METAMONAD_DICT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/dict.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    using v1::dict;
+  }
+}
+
+#endif
+
@@ -0,0 +1,17 @@
+#ifndef MPLLIBS_METAMONAD_MEMO_METAFUNCTION_HPP
+#define MPLLIBS_METAMONAD_MEMO_METAFUNCTION_HPP
+
+//    Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/memo_metafunction.hpp>
+
+#ifdef MPLLIBS_MEMO_METAFUNCTION
+#  error MPLLIBS_MEMO_METAFUNCTION already defined
+#endif
+#define MPLLIBS_MEMO_METAFUNCTION MPLLIBS_V1_MEMO_METAFUNCTION
+
+#endif
+
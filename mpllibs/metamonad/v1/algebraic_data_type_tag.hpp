@@ -7,16 +7,10 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metamonad/v1/fwd/algebraic_data_type_tag.hpp>
-#include <mpllibs/metamonad/v1/impl/rec_equal_to.hpp>
-
 #include <mpllibs/metamonad/v1/tmp_value.hpp>
-#include <mpllibs/metamonad/v1/lazy_metafunction.hpp>
-
-#include <mpllibs/boost.hpp>
 
-#include <boost/mpl/always.hpp>
-#include <boost/mpl/bool.hpp>
-#include <boost/mpl/equal.hpp>
+// The comparison of the values using boost::mpl::equal_to is in
+// algebraic_data_type_tag_mpl.hpp
 
 namespace mpllibs
 {
@@ -29,37 +23,5 @@ namespace mpllibs
   }
 }
 
-namespace MPLLIBS_BOOST_NAMESPACE
-{
-  namespace mpl
-  {
-    template <class, class>
-    struct equal_to_impl;
-    
-    template <class T>
-    struct equal_to_impl<T, mpllibs::metamonad::v1::algebraic_data_type_tag> :
-      always<false_>
-    {};
-    
-    template <class T>
-    struct equal_to_impl<mpllibs::metamonad::v1::algebraic_data_type_tag, T> :
-      always<false_>
-    {};
-    
-    template <>
-    struct
-      equal_to_impl<
-        mpllibs::metamonad::v1::algebraic_data_type_tag,
-        mpllibs::metamonad::v1::algebraic_data_type_tag
-      >
-    {
-      typedef equal_to_impl type;
-      
-      MPLLIBS_V1_LAZY_METAFUNCTION(apply, (A)(B))
-      ((mpllibs::metamonad::v1::impl::rec_equal_to<A, B>));
-    };
-  }
-}
-
 #endif
 
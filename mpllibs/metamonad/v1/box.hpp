@@ -19,7 +19,6 @@
 #include <mpllibs/boost.hpp>
 
 #include <boost/mpl/bool.hpp>
-#include <boost/mpl/map.hpp>
 
 namespace mpllibs
 {
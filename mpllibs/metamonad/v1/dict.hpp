@@ -0,0 +1,30 @@
+#ifndef MPLLIBS_METAMONAD_V1_DICT_HPP
+#define MPLLIBS_METAMONAD_V1_DICT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/fwd/dict.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      // The empty dictionary
+      struct dict : tmp_value<dict>
+      {
+        typedef boost::mpl::list<> entries;
+      };
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,75 @@
+#ifndef MPLLIBS_METAMONAD_V1_DICT_AT_HPP
+#define MPLLIBS_METAMONAD_V1_DICT_AT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/fwd/dict_at.hpp>
+#include <mpllibs/metamonad/v1/impl/dict_node.hpp>
+
+#include <boost/config.hpp>
+
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/aux_/config/typeof.hpp>
+
+#ifdef MPLLIBS_DICT_TYPEOF
+#  error MPLLIBS_DICT_TYPEOF already defined
+#endif
+#if !defined BOOST_NO_CXX11_DECLTYPE && !defined BOOST_NO_DECLTYPE
+#  define MPLLIBS_DICT_TYPEOF decltype
+#elif defined BOOST_MPL_CFG_HAS_TYPEOF
+#  define MPLLIBS_DICT_TYPEOF __typeof__
+#endif
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+#ifndef MPLLIBS_DICT_TYPEOF
+        // Without decltype or typeof the elements are checked one by one
+        template <class D, class Key>
+        struct dict_at_impl;
+
+        template <class Key, class Value, class Base>
+        struct dict_at_impl<dict_node<Key, Value, Base>, Key> :
+          boost::mpl::identity<Value>
+        {};
+
+        template <class K, class Value, class Base, class Key>
+        struct dict_at_impl<dict_node<K, Value, Base>, Key> :
+          dict_at_impl<Base, Key>
+        {};
+#else
+        template <class Key, class Value>
+        boost::mpl::identity<Value> dict_lookup(const dict_entry<Key, Value>*);
+
+        template <class D, class Key>
+        struct dict_at_impl
+        {
+          typedef
+            MPLLIBS_DICT_TYPEOF(dict_lookup<Key>(static_cast<const D*>(0)))
+            found;
+
+          typedef typename found::type type;
+        };
+#endif
+      }
+
+      template <class D, class Key>
+      struct dict_at : impl::dict_at_impl<typename D::type, Key> {};
+    }
+  }
+}
+
+#ifdef MPLLIBS_DICT_TYPEOF
+#  undef MPLLIBS_DICT_TYPEOF
+#endif
+
+#endif
+
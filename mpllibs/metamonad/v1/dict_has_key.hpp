@@ -0,0 +1,43 @@
+#ifndef MPLLIBS_METAMONAD_V1_DICT_HAS_KEY_HPP
+#define MPLLIBS_METAMONAD_V1_DICT_HAS_KEY_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/fwd/dict_has_key.hpp>
+#include <mpllibs/metamonad/v1/impl/dict_node.hpp>
+#include <mpllibs/metamonad/v1/impl/yes.hpp>
+#include <mpllibs/metamonad/v1/impl/no.hpp>
+
+#include <boost/mpl/bool.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class Key>
+        no dict_has_key_test(...);
+
+        template <class Key, class Value>
+        yes dict_has_key_test(const dict_entry<Key, Value>*);
+      }
+
+      template <class D, class Key>
+      struct dict_has_key :
+        boost::mpl::bool_<
+          sizeof(impl::dict_has_key_test<Key>((typename D::type*)0))
+          == sizeof(impl::yes)
+        >
+      {};
+    }
+  }
+}
+
+#endif
+
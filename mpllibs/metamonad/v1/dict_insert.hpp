@@ -0,0 +1,35 @@
+#ifndef MPLLIBS_METAMONAD_V1_DICT_INSERT_HPP
+#define MPLLIBS_METAMONAD_V1_DICT_INSERT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/fwd/dict_insert.hpp>
+#include <mpllibs/metamonad/v1/dict_has_key.hpp>
+#include <mpllibs/metamonad/v1/impl/dict_node.hpp>
+
+#include <boost/mpl/if.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      // The dictionary is not changed when it already has Key
+      template <class D, class Key, class Value>
+      struct dict_insert :
+        boost::mpl::if_<
+          typename dict_has_key<D, Key>::type,
+          typename D::type,
+          impl::dict_node<Key, Value, typename D::type>
+        >::type
+      {};
+    }
+  }
+}
+
+#endif
+
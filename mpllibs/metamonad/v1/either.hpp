@@ -8,6 +8,7 @@
 
 #include <mpllibs/metamonad/v1/fwd/either.hpp>
 #include <mpllibs/metamonad/v1/fwd/monad.hpp>
+#include <mpllibs/metamonad/v1/impl/either_bind.hpp>
 #include <mpllibs/metamonad/v1/data.hpp>
 #include <mpllibs/metamonad/v1/eval_case.hpp>
 #include <mpllibs/metamonad/v1/lambda.hpp>
@@ -27,14 +28,7 @@ namespace mpllibs
       {
         typedef right<> return_;
         
-        typedef
-          lambda_c<a, f,
-            eval_case< a,
-              matches_c<left<_>,  a>,
-              matches_c<right<x>, apply<f, x> >
-            >
-          >
-          bind;
+        typedef impl::either_bind bind;
 
         typedef left<> fail;
       };
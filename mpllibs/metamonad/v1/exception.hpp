@@ -6,19 +6,15 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <mpllibs/metamonad/v1/fwd/exception.hpp>
-#include <mpllibs/metamonad/v1/algebraic_data_type_tag.hpp>
+#include <mpllibs/metamonad/v1/impl/exception_core.hpp>
+#include <mpllibs/metamonad/v1/algebraic_data_type_tag_mpl.hpp>
 #include <mpllibs/metamonad/v1/exception_tag.hpp>
+#include <mpllibs/metamonad/v1/impl/exception_bind.hpp>
+#include <mpllibs/metamonad/v1/impl/do_bind_.hpp>
 
 #include <mpllibs/metamonad/v1/monad.hpp>
 #include <mpllibs/metamonad/v1/lambda.hpp>
 #include <mpllibs/metamonad/v1/name.hpp>
-#include <mpllibs/metamonad/v1/eval_case.hpp>
-#include <mpllibs/metamonad/v1/apply.hpp>
-
-#include <string>
-#include <sstream>
-#include <iostream>
 
 namespace mpllibs
 {
@@ -26,35 +22,6 @@ namespace mpllibs
   {
     namespace v1
     {
-      template <class Reason>
-      struct exception
-      {
-        typedef exception<typename Reason::type> type;
-        typedef algebraic_data_type_tag tag;
-  
-        static std::string get_value()
-        {
-          std::ostringstream s;
-          s << "exception<" << Reason::get_value() << ">";
-          return s.str();
-        }
-  
-        static const std::string value;
-      };
-  
-      template <class Reason>
-      const std::string
-        exception<Reason>::value = exception<Reason>::get_value();
-  
-      // Currying
-      template <>
-      struct exception<boost::mpl::void_> :
-        tmp_value<exception<boost::mpl::void_>, tag_tag>
-      {
-        template <class Reason>
-        struct apply : exception<Reason> {};
-      };
-
       /*
        * The Exception monad
        * This is modeled along the Either monad of Haskell
@@ -69,16 +36,17 @@ namespace mpllibs
       struct monad<exception_tag> : monad_defaults<exception_tag>
       {
         typedef lambda_c<t, t> return_;
-        
-        typedef
-          lambda_c<a, f,
-            eval_case< a,
-              matches_c<exception<_>, a>,
-              matches_c<_, apply<f, a> >
-            >
-          >
-          bind;
+        typedef impl::exception_bind bind;
       };
+
+      namespace impl
+      {
+        // An exception skips the rest of the do block without evaluating it
+        template <class T, class Rest>
+        struct do_bind_<exception_tag, T, Rest> :
+          exception_bind_<typename T::type, Rest>
+        {};
+      }
     }
   }
 }
@@ -0,0 +1,22 @@
+#ifndef MPLLIBS_METAMONAD_V1_FWD_DICT_HAS_KEY_HPP
+#define MPLLIBS_METAMONAD_V1_FWD_DICT_HAS_KEY_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      template <class D, class Key>
+      struct dict_has_key;
+    }
+  }
+}
+
+#endif
+
@@ -10,6 +10,7 @@
 #include <mpllibs/metamonad/v1/if_.hpp>
 #include <mpllibs/metamonad/v1/metafunction.hpp>
 #include <mpllibs/metamonad/v1/mzero.hpp>
+#include <mpllibs/metamonad/v1/return_.hpp>
 
 #include <boost/mpl/void.hpp>
 
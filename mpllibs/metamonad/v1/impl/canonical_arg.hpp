@@ -0,0 +1,48 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_CANONICAL_ARG_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_CANONICAL_ARG_HPP
+
+//    Copyright Abel Sinkovics (abel@sinkovics.hu) 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/integral_c.hpp>
+#include <boost/mpl/integral_c_tag.hpp>
+#include <boost/mpl/tag.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Integral wrappers representing the same value (eg. int_<1> and
+        // integral_c<int, 1>) are mapped to the same type
+        template <
+          class T,
+          class Tag = typename boost::mpl::tag<typename T::type>::type
+        >
+        struct canonical_arg
+        {
+          typedef typename T::type type;
+        };
+
+        template <class T>
+        struct canonical_arg<T, boost::mpl::integral_c_tag>
+        {
+          typedef
+            boost::mpl::integral_c<
+              typename T::type::value_type,
+              T::type::value
+            >
+            type;
+        };
+      }
+    }
+  }
+}
+
+#endif
+
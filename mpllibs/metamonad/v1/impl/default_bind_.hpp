@@ -0,0 +1,36 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_DEFAULT_BIND__HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_DEFAULT_BIND__HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/impl/ignore_argument.hpp>
+
+#include <mpllibs/metamonad/v1/bind.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class Tag>
+        struct default_bind_ : tmp_value<default_bind_<Tag> >
+        {
+          template <class A, class B>
+          struct apply :
+            mpllibs::metamonad::v1::bind<Tag, A, ignore_argument<B> >
+          {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
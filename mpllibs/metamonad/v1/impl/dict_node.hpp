@@ -0,0 +1,43 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_DICT_NODE_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_DICT_NODE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/pair.hpp>
+#include <boost/mpl/push_front.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Every element of a dictionary is a base class of it. The elements
+        // are found by overload resolution on these base classes.
+        template <class Key, class Value>
+        struct dict_entry {};
+
+        template <class Key, class Value, class Base>
+        struct dict_node : Base, dict_entry<Key, Value>
+        {
+          typedef dict_node type;
+
+          typedef
+            typename boost::mpl::push_front<
+              typename Base::entries,
+              boost::mpl::pair<Key, Value>
+            >::type
+            entries;
+        };
+      }
+    }
+  }
+}
+
+#endif
+
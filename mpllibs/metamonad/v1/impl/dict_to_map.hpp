@@ -0,0 +1,36 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_DICT_TO_MAP_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_DICT_TO_MAP_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/instantiate.hpp>
+
+#include <boost/mpl/map.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The boost::mpl::map is built in one step from the elements
+        template <class D>
+        struct dict_to_map :
+          BOOST_PP_CAT(instantiate, BOOST_MPL_LIMIT_MAP_SIZE)<
+            boost::mpl::map
+          >::template apply<typename D::type::entries>
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
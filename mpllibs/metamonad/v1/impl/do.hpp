@@ -6,6 +6,8 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
+#include <mpllibs/metamonad/v1/impl/do_bind_.hpp>
+
 #include <mpllibs/metamonad/limit_do_size.hpp>
 #include <mpllibs/metamonad/v1/lambda_c.hpp>
 #include <mpllibs/metamonad/v1/monad.hpp>
@@ -52,8 +54,8 @@ namespace mpllibs
             BOOST_PP_ENUM_PARAMS(BOOST_PP_DEC(n), class E) \
           > \
           struct BOOST_PP_CAT(do, n) : \
-            apply< \
-              typename monad<Monad>::bind_, \
+            do_bind_< \
+              Monad, \
               T, \
               BOOST_PP_CAT(do, BOOST_PP_DEC(n))< \
                 Monad, \
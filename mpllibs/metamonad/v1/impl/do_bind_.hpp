@@ -0,0 +1,31 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_DO_BIND__HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_DO_BIND__HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/monad.hpp>
+#include <mpllibs/metamonad/v1/apply.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Binds the rest of a do block to one of its elements. Rest is not
+        // evaluated before the call, thus monads can specialise this template
+        // to skip the rest of the block.
+        template <class Monad, class T, class Rest>
+        struct do_bind_ : apply<typename monad<Monad>::bind_, T, Rest> {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,41 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_EITHER_BIND_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_EITHER_BIND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/fwd/either.hpp>
+#include <mpllibs/metamonad/v1/fwd/exception.hpp>
+#include <mpllibs/metamonad/v1/no_case_matched.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/returns.hpp>
+#include <mpllibs/metamonad/v1/apply.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct either_bind : tmp_value<either_bind>
+        {
+          template <class A, class F>
+          struct apply : exception<no_case_matched<A> > {};
+
+          template <class T, class F>
+          struct apply<left<T>, F> : returns<left<T> > {};
+
+          template <class T, class F>
+          struct apply<right<T>, F> : mpllibs::metamonad::v1::apply<F, T> {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,43 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_EXCEPTION_BIND_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_EXCEPTION_BIND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/fwd/exception.hpp>
+#include <mpllibs/metamonad/v1/returns.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/apply.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct exception_bind : tmp_value<exception_bind>
+        {
+          template <class A, class F>
+          struct apply : mpllibs::metamonad::v1::apply<F, A> {};
+
+          template <class R, class F>
+          struct apply<exception<R>, F> : returns<exception<R> > {};
+        };
+
+        // A is evaluated, Rest is evaluated only when A is not an exception
+        template <class A, class Rest>
+        struct exception_bind_ : Rest {};
+
+        template <class R, class Rest>
+        struct exception_bind_<exception<R>, Rest> : returns<exception<R> > {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,59 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_EXCEPTION_CORE_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_EXCEPTION_CORE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// The exception values without the monad instance. The headers reporting
+// errors with exceptions use this to avoid depending on the monad library
+// and on the MPL containers (see algebraic_data_type_tag_mpl.hpp).
+
+#include <mpllibs/metamonad/v1/fwd/exception.hpp>
+#include <mpllibs/metamonad/v1/algebraic_data_type_tag.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/tag_tag.hpp>
+
+#include <boost/mpl/void.hpp>
+
+#include <string>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      template <class Reason>
+      struct exception
+      {
+        typedef exception<typename Reason::type> type;
+        typedef algebraic_data_type_tag tag;
+  
+        static std::string get_value()
+        {
+          return std::string("exception<") + Reason::get_value() + ">";
+        }
+  
+        static const std::string value;
+      };
+  
+      template <class Reason>
+      const std::string
+        exception<Reason>::value = exception<Reason>::get_value();
+  
+      // Currying
+      template <>
+      struct exception<boost::mpl::void_> :
+        tmp_value<exception<boost::mpl::void_>, tag_tag>
+      {
+        template <class Reason>
+        struct apply : exception<Reason> {};
+      };
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,34 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_IGNORE_ARGUMENT_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_IGNORE_ARGUMENT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/returns.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Metafunction class returning T for any argument. It is a cheaper
+        // alternative of lambda_c<_, T>.
+        template <class T>
+        struct ignore_argument : tmp_value<ignore_argument<T> >
+        {
+          template <class>
+          struct apply : returns<T> {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
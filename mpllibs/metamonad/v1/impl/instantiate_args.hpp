@@ -0,0 +1,57 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_INSTANTIATE_ARGS_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_INSTANTIATE_ARGS_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/next.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The elements of a sequence from Begin to End. The elements are
+        // arg, next::arg, next::next::arg, ... Every iterator is visited
+        // once, the elements after End are boost::mpl::na.
+        template <class Begin, class End>
+        struct instantiate_args
+        {
+          typedef instantiate_args type;
+
+          typedef typename boost::mpl::deref<Begin>::type arg;
+          typedef
+            instantiate_args<typename boost::mpl::next<Begin>::type, End>
+            next;
+        };
+
+        template <class End>
+        struct instantiate_args<End, End>
+        {
+          typedef instantiate_args type;
+
+          typedef boost::mpl::na arg;
+          typedef instantiate_args next;
+        };
+
+        template <class Seq>
+        struct to_instantiate_args :
+          instantiate_args<
+            typename boost::mpl::begin<Seq>::type,
+            typename boost::mpl::end<Seq>::type
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,114 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_LAMBDA_APPLY_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_LAMBDA_APPLY_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/impl/lambda_maybe_eval.hpp>
+#include <mpllibs/metamonad/v1/impl/lambda_impl_step.hpp>
+
+#include <boost/mpl/limits/arity.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/arithmetic/sub.hpp>
+#include <boost/preprocessor/punctuation/comma_if.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/enum_params_with_a_default.hpp>
+#include <boost/preprocessor/tuple/eat.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Binds the arguments one by one using lambda_impl_step. There is a
+        // specialisation for each number of arguments, thus calling a lambda
+        // with n arguments does not depend on BOOST_MPL_LIMIT_METAFUNCTION_ARITY
+        template <
+          class State,
+          BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(
+            BOOST_MPL_LIMIT_METAFUNCTION_ARITY,
+            class T,
+            boost::mpl::na
+          )
+        >
+        struct lambda_apply;
+
+        #ifdef MPLLIBS_LAMBDA_STEP_OPEN
+        #  error MPLLIBS_LAMBDA_STEP_OPEN already defined
+        #endif
+        #define MPLLIBS_LAMBDA_STEP_OPEN(z, n, unused) \
+          typename lambda_impl_step::apply<
+
+        #ifdef MPLLIBS_LAMBDA_STEP_CLOSE
+        #  error MPLLIBS_LAMBDA_STEP_CLOSE already defined
+        #endif
+        #define MPLLIBS_LAMBDA_STEP_CLOSE(z, n, unused) \
+          , BOOST_PP_CAT(T, n)>::type
+
+        #ifdef MPLLIBS_LAMBDA_APPLY
+        #  error MPLLIBS_LAMBDA_APPLY already defined
+        #endif
+        #define MPLLIBS_LAMBDA_APPLY(z, n, unused) \
+          template <class State BOOST_PP_COMMA_IF(n) \
+            BOOST_PP_ENUM_PARAMS(n, class T)> \
+          struct \
+            lambda_apply< \
+              State, \
+              BOOST_PP_ENUM_PARAMS(n, T) BOOST_PP_COMMA_IF(n) \
+              BOOST_PP_ENUM( \
+                BOOST_PP_SUB(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, n), \
+                boost::mpl::na BOOST_PP_TUPLE_EAT(3), \
+                ~ \
+              ) \
+            > : \
+            lambda_maybe_eval< \
+              BOOST_PP_REPEAT(n, MPLLIBS_LAMBDA_STEP_OPEN, ~) \
+                State \
+              BOOST_PP_REPEAT(n, MPLLIBS_LAMBDA_STEP_CLOSE, ~) \
+            > \
+          {};
+
+        BOOST_PP_REPEAT(
+          BOOST_MPL_LIMIT_METAFUNCTION_ARITY,
+          MPLLIBS_LAMBDA_APPLY,
+          ~
+        )
+
+        template <
+          class State,
+          BOOST_PP_ENUM_PARAMS(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, class T)
+        >
+        struct lambda_apply :
+          lambda_maybe_eval<
+            BOOST_PP_REPEAT(
+              BOOST_MPL_LIMIT_METAFUNCTION_ARITY,
+              MPLLIBS_LAMBDA_STEP_OPEN,
+              ~
+            )
+              State
+            BOOST_PP_REPEAT(
+              BOOST_MPL_LIMIT_METAFUNCTION_ARITY,
+              MPLLIBS_LAMBDA_STEP_CLOSE,
+              ~
+            )
+          >
+        {};
+
+        #undef MPLLIBS_LAMBDA_APPLY
+        #undef MPLLIBS_LAMBDA_STEP_CLOSE
+        #undef MPLLIBS_LAMBDA_STEP_OPEN
+      }
+    }
+  }
+}
+
+#endif
+
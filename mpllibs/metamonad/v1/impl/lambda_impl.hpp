@@ -8,8 +8,7 @@
 
 #include <mpllibs/metamonad/v1/impl/fwd/lambda_impl.hpp>
 #include <mpllibs/metamonad/v1/impl/fwd/let_impl.hpp>
-#include <mpllibs/metamonad/v1/impl/lambda_maybe_eval.hpp>
-#include <mpllibs/metamonad/v1/impl/lambda_impl_step.hpp>
+#include <mpllibs/metamonad/v1/impl/lambda_apply.hpp>
 #include <mpllibs/metamonad/v1/impl/let_in_syntax.hpp>
 
 #include <mpllibs/metamonad/v1/tmp_value.hpp>
@@ -18,8 +17,6 @@
 #include <mpllibs/metamonad/v1/second.hpp>
 #include <mpllibs/metamonad/v1/pair.hpp>
 
-#include <boost/mpl/vector.hpp>
-#include <boost/mpl/fold.hpp>
 #include <boost/mpl/contains.hpp>
 
 #include <boost/preprocessor/repetition/enum_params_with_a_default.hpp>
@@ -44,14 +41,9 @@ namespace mpllibs
             )
           >
           struct apply :
-            lambda_maybe_eval<
-              boost::mpl::fold<
-                boost::mpl::vector<
-                  BOOST_PP_ENUM_PARAMS(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, T)
-                >,
-                State,
-                lambda_impl_step
-              >
+            lambda_apply<
+              State,
+              BOOST_PP_ENUM_PARAMS(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, T)
             >
           {};
         };
@@ -0,0 +1,32 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_LIST_RETURN_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_LIST_RETURN_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct list_return : tmp_value<list_return>
+        {
+          template <class T>
+          struct apply : boost::mpl::list<T> {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
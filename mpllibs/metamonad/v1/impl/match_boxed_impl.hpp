@@ -8,6 +8,8 @@
 
 #include <mpllibs/metamonad/v1/impl/lazy_match_c_impl.hpp>
 #include <mpllibs/metamonad/v1/impl/merge_map.hpp>
+#include <mpllibs/metamonad/v1/impl/dict_to_map.hpp>
+#include <mpllibs/metamonad/v1/dict.hpp>
 #include <mpllibs/metamonad/v1/is_exception.hpp>
 #include <mpllibs/metamonad/v1/metafunction.hpp>
 #include <mpllibs/metamonad/v1/unbox.hpp>
@@ -15,7 +17,6 @@
 #include <mpllibs/metamonad/v1/name.hpp>
 #include <mpllibs/metamonad/v1/if_.hpp>
 
-#include <boost/mpl/map.hpp>
 #include <boost/mpl/fold.hpp>
 #include <boost/mpl/vector.hpp>
 #include <boost/mpl/zip_view.hpp>
@@ -30,23 +31,31 @@ namespace mpllibs
     {
       namespace impl
       {
+        template <class D>
+        struct match_boxed_result :
+          if_<is_exception<D>, D, dict_to_map<D> >
+        {};
+
         // Elements of Ps and Vs are boxed because Ps or Vs may contain mpl::na
         // in which case Ps and Vs have different sizes and zip_view can not
-        // handle that.
+        // handle that. The bindings are collected in a dict, the map is built
+        // once at the end.
         MPLLIBS_V1_METAFUNCTION(match_boxed_impl, (Ps)(Vs))
         ((
-          boost::mpl::fold<
-            boost::mpl::zip_view<boost::mpl::vector<Ps, Vs> >,
-            boost::mpl::map<>,
-            lambda_c<s, p,
-              if_<
-                is_exception<s>,
-                s,
-                merge_map<
+          match_boxed_result<
+            boost::mpl::fold<
+              boost::mpl::zip_view<boost::mpl::vector<Ps, Vs> >,
+              dict,
+              lambda_c<s, p,
+                if_<
+                  is_exception<s>,
                   s,
-                  impl::lazy_match_c_impl<
-                    unbox<boost::mpl::front<p> >,
-                    unbox<boost::mpl::back<p> >
+                  merge_map<
+                    s,
+                    impl::lazy_match_c_impl<
+                      unbox<boost::mpl::front<p> >,
+                      unbox<boost::mpl::back<p> >
+                    >
                   >
                 >
               >
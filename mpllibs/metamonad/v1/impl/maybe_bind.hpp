@@ -0,0 +1,41 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_MAYBE_BIND_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_MAYBE_BIND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/impl/maybe.hpp>
+
+#include <mpllibs/metamonad/v1/fwd/exception.hpp>
+#include <mpllibs/metamonad/v1/no_case_matched.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/apply.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct maybe_bind : tmp_value<maybe_bind>
+        {
+          template <class A, class F>
+          struct apply : exception<no_case_matched<A> > {};
+
+          template <class F>
+          struct apply<nothing, F> : nothing {};
+
+          template <class T, class F>
+          struct apply<just<T>, F> : mpllibs::metamonad::v1::apply<F, T> {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
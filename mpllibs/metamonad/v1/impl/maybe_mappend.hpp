@@ -0,0 +1,51 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_MAYBE_MAPPEND_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_MAYBE_MAPPEND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/impl/maybe.hpp>
+
+#include <mpllibs/metamonad/v1/fwd/exception.hpp>
+#include <mpllibs/metamonad/v1/no_case_matched.hpp>
+#include <mpllibs/metamonad/v1/mappend.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/returns.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class T>
+        struct maybe_mappend : tmp_value<maybe_mappend<T> >
+        {
+          template <class A, class B>
+          struct apply : exception<no_case_matched<A> > {};
+
+          template <class B>
+          struct apply<nothing, B> : returns<B> {};
+
+          template <class C, class B>
+          struct apply<just<C>, B> : exception<no_case_matched<B> > {};
+
+          template <class C>
+          struct apply<just<C>, nothing> : returns<just<C> > {};
+
+          template <class C, class D>
+          struct apply<just<C>, just<D> > :
+            just<mpllibs::metamonad::v1::mappend<T, C, D> >
+          {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
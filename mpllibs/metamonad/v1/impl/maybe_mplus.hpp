@@ -0,0 +1,36 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_MAYBE_MPLUS_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_MAYBE_MPLUS_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/impl/maybe.hpp>
+
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/returns.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct maybe_mplus : tmp_value<maybe_mplus>
+        {
+          template <class A, class B>
+          struct apply : returns<A> {};
+
+          template <class B>
+          struct apply<nothing, B> : returns<B> {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
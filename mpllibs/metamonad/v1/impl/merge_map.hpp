@@ -21,6 +21,7 @@ namespace mpllibs
     {
       namespace impl
       {
+        // A is a dict, the elements of the map B are added to it
         MPLLIBS_V1_METAFUNCTION(merge_map, (A)(B))
         ((
           if_<
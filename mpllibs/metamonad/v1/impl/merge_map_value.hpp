@@ -7,22 +7,16 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metamonad/v1/fwd/exception.hpp>
-#include <mpllibs/metamonad/v1/impl/map_insert.hpp>
+#include <mpllibs/metamonad/v1/dict_at.hpp>
+#include <mpllibs/metamonad/v1/dict_has_key.hpp>
+#include <mpllibs/metamonad/v1/dict_insert.hpp>
 #include <mpllibs/metamonad/v1/is_exception.hpp>
-#include <mpllibs/metamonad/v1/lazy.hpp>
-#include <mpllibs/metamonad/v1/already_lazy.hpp>
-#include <mpllibs/metamonad/v1/lazy_protect_args.hpp>
-#include <mpllibs/metamonad/v1/lambda_c.hpp>
-#include <mpllibs/metamonad/v1/name.hpp>
 #include <mpllibs/metamonad/v1/if_.hpp>
 #include <mpllibs/metamonad/v1/first.hpp>
 #include <mpllibs/metamonad/v1/second.hpp>
 #include <mpllibs/metamonad/v1/is_same.hpp>
 #include <mpllibs/metamonad/v1/bad_match.hpp>
 
-#include <boost/mpl/has_key.hpp>
-#include <boost/mpl/at.hpp>
-
 namespace mpllibs
 {
   namespace metamonad
@@ -31,36 +25,32 @@ namespace mpllibs
     {
       namespace impl
       {
-        typedef
-          lambda_c<s, p,
+        // S is a dict, P is an element of the map being merged into it
+        struct merge_map_value
+        {
+          typedef merge_map_value type;
+
+          template <class S, class P>
+          struct apply :
             if_<
-              is_exception<s>,
-              s,
+              is_exception<S>,
+              S,
               if_<
-                lazy<
-                  boost::mpl::has_key<
-                    already_lazy<s>,
-                    lazy_protect_args<first<p> >
-                  >
-                >,
+                dict_has_key<S, typename first<P>::type>,
                 if_<
-                  is_same<
-                    lazy<
-                      boost::mpl::at<
-                        already_lazy<s>,
-                        lazy_protect_args<first<p> >
-                      >
-                    >,
-                    second<p>
-                  >,
-                  s,
-                  exception<bad_match<first<p>, second<p> > >
+                  is_same<dict_at<S, typename first<P>::type>, second<P> >,
+                  S,
+                  exception<bad_match<first<P>, second<P> > >
                 >,
-                map_insert<s, p>
+                dict_insert<
+                  S,
+                  typename first<P>::type,
+                  typename second<P>::type
+                >
               >
             >
-          >
-          merge_map_value;
+          {};
+        };
       }
     }
   }
@@ -11,7 +11,7 @@
 
 #include <mpllibs/metamonad/v1/lazy_metafunction.hpp>
 #include <mpllibs/metamonad/v1/calculated_value.hpp>
-#include <mpllibs/metamonad/v1/algebraic_data_type_tag.hpp>
+#include <mpllibs/metamonad/v1/algebraic_data_type_tag_mpl.hpp>
 
 #include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
@@ -7,7 +7,7 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metamonad/v1/calculated_value.hpp>
-#include <mpllibs/metamonad/v1/algebraic_data_type_tag.hpp>
+#include <mpllibs/metamonad/v1/algebraic_data_type_tag_mpl.hpp>
 
 #include <boost/preprocessor/stringize.hpp>
 
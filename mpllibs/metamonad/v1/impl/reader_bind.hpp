@@ -0,0 +1,46 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_READER_BIND_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_READER_BIND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/apply.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class A, class F>
+        struct reader_bound : tmp_value<reader_bound<A, F> >
+        {
+          template <class R>
+          struct apply :
+            mpllibs::metamonad::v1::apply<
+              mpllibs::metamonad::v1::apply<
+                F,
+                mpllibs::metamonad::v1::apply<A, R>
+              >,
+              R
+            >
+          {};
+        };
+
+        struct reader_bind : tmp_value<reader_bind>
+        {
+          template <class A, class F>
+          struct apply : reader_bound<A, F> {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
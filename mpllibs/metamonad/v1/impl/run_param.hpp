@@ -11,8 +11,6 @@
 #include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/control/if.hpp>
 
-#include <iostream>
-
 #ifdef MPLLIBS_V1_RUN_PARAM
 #  error MPLLIBS_V1_RUN_PARAM already defined
 #endif
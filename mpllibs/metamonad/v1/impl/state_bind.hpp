@@ -0,0 +1,67 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_STATE_BIND_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_STATE_BIND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/eval_match_let_c.hpp>
+#include <mpllibs/metamonad/v1/name.hpp>
+#include <mpllibs/metamonad/v1/pair.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/apply.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Handles the case when the state transition does not return a pair
+        template <class P, class F>
+        struct state_bind_step :
+          eval_match_let_c<
+            pair<t, u>,
+            P,
+            mpllibs::metamonad::v1::apply<
+              mpllibs::metamonad::v1::apply<F, t>,
+              u
+            >
+          >
+        {};
+
+        template <class T, class U, class F>
+        struct state_bind_step<pair<T, U>, F> :
+          mpllibs::metamonad::v1::apply<
+            mpllibs::metamonad::v1::apply<F, T>,
+            U
+          >
+        {};
+
+        template <class A, class F>
+        struct state_bound : tmp_value<state_bound<A, F> >
+        {
+          template <class S>
+          struct apply :
+            state_bind_step<
+              typename mpllibs::metamonad::v1::apply<A, S>::type,
+              F
+            >
+          {};
+        };
+
+        struct state_bind : tmp_value<state_bind>
+        {
+          template <class A, class F>
+          struct apply : state_bound<A, F> {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,105 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_TRY_IMPL_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_TRY_IMPL_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/impl/handle_catch.hpp>
+
+#include <mpllibs/metamonad/v1/exception.hpp>
+#include <mpllibs/metamonad/v1/returns.hpp>
+#include <mpllibs/metamonad/v1/pair.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/limits/arity.hpp>
+
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/enum_shifted_params.hpp>
+#include <boost/preprocessor/repetition/enum_params_with_a_default.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/tuple/eat.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Result of a catch block that did not handle the exception: the
+        // remaining catch blocks are tried.
+        template <class HandleResult, class Rest>
+        struct try_catch_result : Rest {};
+
+        template <class Result, class Rest>
+        struct try_catch_result<pair<boost::mpl::false_, Result>, Rest> :
+          Result
+        {};
+
+        // Tries the catch blocks one by one until one of them handles E
+        template <
+          class E,
+          BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(
+            BOOST_MPL_LIMIT_METAFUNCTION_ARITY,
+            class Catch,
+            boost::mpl::na
+          )
+        >
+        struct try_catch :
+          try_catch_result<
+            typename handle_catch<E, Catch0>::type,
+            try_catch<
+              E,
+              BOOST_PP_ENUM_SHIFTED_PARAMS(
+                BOOST_MPL_LIMIT_METAFUNCTION_ARITY,
+                Catch
+              )
+            >
+          >
+        {};
+
+        template <class E>
+        struct
+          try_catch<
+            E,
+            BOOST_PP_ENUM(
+              BOOST_MPL_LIMIT_METAFUNCTION_ARITY,
+              boost::mpl::na BOOST_PP_TUPLE_EAT(3),
+              ~
+            )
+          > :
+          returns<exception<E> >
+        {};
+
+        // A is the evaluated result of the expression in the try block. The
+        // catch blocks are not touched when it is not an exception.
+        template <
+          class A,
+          BOOST_PP_ENUM_PARAMS(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, class Catch)
+        >
+        struct try_impl : returns<A> {};
+
+        template <
+          class E,
+          BOOST_PP_ENUM_PARAMS(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, class Catch)
+        >
+        struct
+          try_impl<
+            exception<E>,
+            BOOST_PP_ENUM_PARAMS(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, Catch)
+          > :
+          try_catch<
+            E,
+            BOOST_PP_ENUM_PARAMS(BOOST_MPL_LIMIT_METAFUNCTION_ARITY, Catch)
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
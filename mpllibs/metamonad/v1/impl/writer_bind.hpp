@@ -0,0 +1,50 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_WRITER_BIND_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_WRITER_BIND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/mappend.hpp>
+#include <mpllibs/metamonad/v1/first.hpp>
+#include <mpllibs/metamonad/v1/second.hpp>
+#include <mpllibs/metamonad/v1/pair.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+#include <mpllibs/metamonad/v1/apply.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class M, class A, class B>
+        struct writer_bind_step :
+          pair<
+            first<B>,
+            mpllibs::metamonad::v1::mappend<M, second<A>, second<B> >
+          >
+        {};
+
+        template <class M>
+        struct writer_bind : tmp_value<writer_bind<M> >
+        {
+          template <class A, class F>
+          struct apply :
+            writer_bind_step<
+              M,
+              A,
+              typename mpllibs::metamonad::v1::apply<F, first<A> >::type
+            >
+          {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,33 @@
+#ifndef MPLLIBS_METAMONAD_V1_IMPL_WRITER_RETURN_HPP
+#define MPLLIBS_METAMONAD_V1_IMPL_WRITER_RETURN_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metamonad/v1/mempty.hpp>
+#include <mpllibs/metamonad/v1/pair.hpp>
+#include <mpllibs/metamonad/v1/tmp_value.hpp>
+
+namespace mpllibs
+{
+  namespace metamonad
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class M>
+        struct writer_return : tmp_value<writer_return<M> >
+        {
+          template <class T>
+          struct apply : pair<T, mpllibs::metamonad::v1::mempty<M> > {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -8,15 +8,7 @@
 
 #include <mpllibs/metamonad/v1/fwd/instantiate.hpp>
 #include <mpllibs/metamonad/v1/tmp_value.hpp>
-#include <mpllibs/metamonad/v1/returns.hpp>
-#include <mpllibs/metamonad/v1/if_.hpp>
-
-#include <boost/mpl/begin_end.hpp>
-#include <boost/mpl/deref.hpp>
-#include <boost/mpl/next.hpp>
-#include <boost/mpl/size.hpp>
-#include <boost/mpl/less.hpp>
-#include <boost/mpl/int.hpp>
+#include <mpllibs/metamonad/v1/impl/instantiate_args.hpp>
 
 #include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/tuple/eat.hpp>
@@ -30,26 +22,13 @@ namespace mpllibs
   {
     namespace v1
     {
-      #ifdef MPLLIBS_CONT_GET_ELEM
-      #  error MPLLIBS_CONT_GET_ELEM already defined
+      #ifdef MPLLIBS_INSTANTIATE_ARG
+      #  error MPLLIBS_INSTANTIATE_ARG already defined
       #endif
-      #define MPLLIBS_CONT_GET_ELEM(z, n, unused) \
-        typename if_< \
-          boost::mpl::less< \
-            boost::mpl::int_<n>, \
-            typename boost::mpl::size<typename V::type>::type \
-          >, \
-          boost::mpl::deref< \
-            BOOST_PP_REPEAT( \
-              n, \
-              typename boost::mpl::next< BOOST_PP_TUPLE_EAT(3), \
-              ~ \
-            ) \
-              typename boost::mpl::begin<typename V::type>::type \
-            BOOST_PP_REPEAT(n, >::type BOOST_PP_TUPLE_EAT(3), ~) \
-          >, \
-          returns<boost::mpl::na> \
-        >::type
+      #define MPLLIBS_INSTANTIATE_ARG(z, n, unused) \
+        typename args:: \
+          BOOST_PP_REPEAT(n, next:: BOOST_PP_TUPLE_EAT(3), ~) \
+          arg
 
       #ifdef MPLLIBS_INSTANTIATE_CASE
       #  error MPLLIBS_INSTANTIATE_CASE already defined
@@ -62,9 +41,14 @@ namespace mpllibs
           tmp_value<BOOST_PP_CAT(instantiate, n)<T> > \
         { \
           template <class V> \
-          struct apply : \
-            returns<T<BOOST_PP_ENUM(n, MPLLIBS_CONT_GET_ELEM, ~)> > \
-          {}; \
+          struct apply \
+          { \
+            typedef \
+              typename impl::to_instantiate_args<typename V::type>::type \
+              args; \
+            \
+            typedef T<BOOST_PP_ENUM(n, MPLLIBS_INSTANTIATE_ARG, ~)> type; \
+          }; \
         };
 
       BOOST_PP_REPEAT_FROM_TO(
@@ -75,7 +59,7 @@ namespace mpllibs
       )
       
       #undef MPLLIBS_INSTANTIATE_CASE
-      #undef MPLLIBS_CONT_GET_ELEM
+      #undef MPLLIBS_INSTANTIATE_ARG
     }
   }
 }
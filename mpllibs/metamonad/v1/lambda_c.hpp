@@ -12,6 +12,7 @@
 #include <mpllibs/metamonad/v1/pair.hpp>
 
 #include <boost/mpl/contains.hpp>
+#include <boost/mpl/vector.hpp>
 
 #include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
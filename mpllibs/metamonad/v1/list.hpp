@@ -7,6 +7,7 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metamonad/v1/list_tag.hpp>
+#include <mpllibs/metamonad/v1/impl/list_return.hpp>
 #include <mpllibs/metamonad/v1/concat.hpp>
 #include <mpllibs/metamonad/v1/tmp_tag.hpp>
 #include <mpllibs/metamonad/v1/monad.hpp>
@@ -27,7 +28,7 @@ namespace mpllibs
       template <>
       struct monad<list_tag> : monad_defaults<list_tag>
       {
-        typedef lambda_c<t, boost::mpl::list<t> > return_;
+        typedef impl::list_return return_;
         typedef concat_map<> bind;
       };
       
@@ -8,6 +8,9 @@
 
 #include <mpllibs/metamonad/v1/fwd/maybe.hpp>
 #include <mpllibs/metamonad/v1/impl/maybe.hpp>
+#include <mpllibs/metamonad/v1/impl/maybe_bind.hpp>
+#include <mpllibs/metamonad/v1/impl/maybe_mplus.hpp>
+#include <mpllibs/metamonad/v1/impl/maybe_mappend.hpp>
 
 #include <mpllibs/metamonad/v1/mappend.hpp>
 #include <mpllibs/metamonad/v1/monad.hpp>
@@ -29,14 +32,7 @@ namespace mpllibs
       {
         typedef just<> return_;
         
-        typedef
-          lambda_c<a, f,
-            eval_case< a,
-              matches_c<nothing, a>,
-              matches_c<just<x>, apply<f, x> >
-            >
-          >
-          bind;
+        typedef impl::maybe_bind bind;
 
         typedef lambda_c<_, nothing> fail;
       };
@@ -46,14 +42,7 @@ namespace mpllibs
       {
         typedef nothing mzero;
 
-        typedef
-          lambda_c<a, b,
-            eval_case< a,
-              matches_c<nothing, b>,
-              matches_c<_,       a>
-            >
-          >
-          mplus;
+        typedef impl::maybe_mplus mplus;
       };
 
       template <class T>
@@ -61,21 +50,7 @@ namespace mpllibs
       {
         typedef nothing mempty;
 
-        typedef
-          lambda_c<a, b,
-            eval_case< a,
-              matches_c<nothing, b>,
-              matches_c<just<c>,
-                eval_case< b,
-                  matches_c<nothing, a>,
-                  matches_c<just<d>,
-                    just<mpllibs::metamonad::v1::mappend<T, c, d> >
-                  >
-                >
-              >
-            >
-          >
-          mappend;
+        typedef impl::maybe_mappend<T> mappend;
       }; 
     }
   }
@@ -9,6 +9,7 @@
 #include <mpllibs/metamonad/v1/fwd/monad.hpp>
 #include <mpllibs/metamonad/v1/fwd/exception.hpp>
 #include <mpllibs/metamonad/v1/bind.hpp>
+#include <mpllibs/metamonad/v1/impl/default_bind_.hpp>
 #include <mpllibs/metamonad/v1/typeclass.hpp>
 #include <mpllibs/metamonad/v1/lambda_c.hpp>
 #include <mpllibs/metamonad/v1/name.hpp>
@@ -30,9 +31,7 @@ namespace mpllibs
       template <class Tag>
       struct monad_defaults : monad<typeclass_expectations>
       {
-        typedef
-          lambda_c<a, b, mpllibs::metamonad::v1::bind<Tag, a, lambda_c<s, b> > >
-          bind_;
+        typedef impl::default_bind_<Tag> bind_;
   
         typedef exception<> fail;
       };
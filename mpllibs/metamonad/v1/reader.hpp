@@ -7,6 +7,8 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metamonad/v1/reader_tag.hpp>
+#include <mpllibs/metamonad/v1/impl/reader_bind.hpp>
+#include <mpllibs/metamonad/v1/impl/reader_return.hpp>
 #include <mpllibs/metamonad/v1/monad.hpp>
 #include <mpllibs/metamonad/v1/lambda.hpp>
 #include <mpllibs/metamonad/v1/name.hpp>
@@ -21,8 +23,8 @@ namespace mpllibs
       template <>
       struct monad<reader_tag> : monad_defaults<reader_tag>
       {
-        typedef lambda_c<t, _, t> return_;
-        typedef lambda_c<a, f, r, apply<apply<f, apply<a, r> >, r> > bind;
+        typedef impl::reader_return return_;
+        typedef impl::reader_bind bind;
       };
     }
   }
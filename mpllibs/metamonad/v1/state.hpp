@@ -7,6 +7,7 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metamonad/v1/state_tag.hpp>
+#include <mpllibs/metamonad/v1/impl/state_bind.hpp>
 #include <mpllibs/metamonad/v1/monad.hpp>
 #include <mpllibs/metamonad/v1/lambda.hpp>
 #include <mpllibs/metamonad/v1/name.hpp>
@@ -25,11 +26,7 @@ namespace mpllibs
       {
         typedef pair<> return_;
 
-        typedef
-          lambda_c<a, f, s,
-            eval_match_let_c<pair<t, u>, apply<a, s>, apply<apply<f, t>, u> >
-          >
-          bind;
+        typedef impl::state_bind bind;
       };
     }
   }
@@ -10,15 +10,13 @@
 #include <mpllibs/metamonad/v1/impl/define_td_metafunction_eval_arg.hpp>
 
 #include <mpllibs/metamonad/v1/overloading_error_tag.hpp>
-#include <mpllibs/metamonad/v1/exception.hpp>
+#include <mpllibs/metamonad/v1/impl/exception_core.hpp>
 #include <mpllibs/metamonad/v1/tmp_value.hpp>
 
 #include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 #include <boost/preprocessor/repetition/enum.hpp>
 
-#include <iostream>
-
 #ifdef MPLLIBS_V1_DEFINE_TAG_DISPATCHING_METAFUNCTION
 #  error MPLLIBS_V1_DEFINE_TAG_DISPATCHING_METAFUNCTION already defined
 #endif
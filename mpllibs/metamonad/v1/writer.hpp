@@ -7,6 +7,8 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metamonad/v1/writer_tag.hpp>
+#include <mpllibs/metamonad/v1/impl/writer_bind.hpp>
+#include <mpllibs/metamonad/v1/impl/writer_return.hpp>
 #include <mpllibs/metamonad/v1/monad.hpp>
 #include <mpllibs/metamonad/v1/lambda.hpp>
 #include <mpllibs/metamonad/v1/name.hpp>
@@ -26,16 +28,8 @@ namespace mpllibs
       template <class M>
       struct monad<writer_tag<M> > : monad_defaults<writer_tag<M> >
       {
-        typedef lambda_c<t, pair<t, mempty<M> > > return_;
-
-        typedef
-          lambda_c<a, f,
-            pair<
-              first<apply<f, first<a> > >,
-              mappend<M, second<a>, second<apply<f, first<a> > > >
-            >
-          >
-          bind;
+        typedef impl::writer_return<M> return_;
+        typedef impl::writer_bind<M> bind;
       };
     }
   }
@@ -0,0 +1,20 @@
+#ifndef MPLLIBS_METAPARSE_CHAR_CLASS_DIFFERENCE_HPP
+#define MPLLIBS_METAPARSE_CHAR_CLASS_DIFFERENCE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/char_class_difference.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    using v1::char_class_difference;
+  }
+}
+
+#endif
+
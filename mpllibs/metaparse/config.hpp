@@ -56,5 +56,17 @@
 #  define MPLLIBS_VARIADIC_STRING
 #endif
 
+#if \
+  defined MPLLIBS_USE_CONSTEXPR \
+  && defined MPLLIBS_USE_VARIADIC_TEMPLATES \
+  && !defined MPLLIBS_NO_CONSTEXPR_C_STR \
+  \
+  && !defined MPLLIBS_NO_CONSTEXPR_PARSERS \
+  && !defined MPLLIBS_CONSTEXPR_PARSERS
+
+  #define MPLLIBS_CONSTEXPR_PARSERS
+
+#endif
+
 #endif
 
@@ -0,0 +1,27 @@
+#ifndef MPLLIBS_METAPARSE_CX_ONE_CHAR_HPP
+#define MPLLIBS_METAPARSE_CX_ONE_CHAR_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/one_char.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace cx
+    {
+      using v1::cx::one_char;
+    }
+  }
+}
+
+#endif
+
+#endif
+
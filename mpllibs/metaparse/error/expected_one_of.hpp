@@ -0,0 +1,23 @@
+#ifndef MPLLIBS_METAPARSE_ERROR_EXPECTED_ONE_OF_HPP
+#define MPLLIBS_METAPARSE_ERROR_EXPECTED_ONE_OF_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/error/expected_one_of.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace error
+    {
+      using v1::error::expected_one_of;
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,20 @@
+#ifndef MPLLIBS_METAPARSE_INFIX_RIGHT_OP_HPP
+#define MPLLIBS_METAPARSE_INFIX_RIGHT_OP_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/infix_right_op.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    using v1::infix_right_op;
+  }
+}
+
+#endif
+
@@ -0,0 +1,14 @@
+#ifndef MPLLIBS_METAPARSE_LIMIT_CHAR_CLASS_SIZE_HPP
+#define MPLLIBS_METAPARSE_LIMIT_CHAR_CLASS_SIZE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MPLLIBS_LIMIT_CHAR_CLASS_SIZE
+#  define MPLLIBS_LIMIT_CHAR_CLASS_SIZE 20
+#endif
+
+#endif
+
@@ -0,0 +1,23 @@
+#ifndef MPLLIBS_METAPARSE_UTIL_IN_CHAR_CLASS_HPP
+#define MPLLIBS_METAPARSE_UTIL_IN_CHAR_CLASS_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/util/in_char_class.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace util
+    {
+      using v1::util::in_char_class;
+    }
+  }
+}
+
+#endif
+
@@ -6,9 +6,12 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <mpllibs/metaparse/v1/one_of.hpp>
-#include <mpllibs/metaparse/v1/digit.hpp>
-#include <mpllibs/metaparse/v1/letter.hpp>
+#include <mpllibs/metaparse/v1/error/none_of_the_expected_cases_found.hpp>
+#include <mpllibs/metaparse/v1/accept_when.hpp>
+#include <mpllibs/metaparse/v1/char_class_range_c.hpp>
+#include <mpllibs/metaparse/v1/char_class_union.hpp>
+#include <mpllibs/metaparse/v1/one_char.hpp>
+#include <mpllibs/metaparse/v1/util/in_char_class.hpp>
 
 namespace mpllibs
 {
@@ -16,7 +19,21 @@ namespace mpllibs
   {
     namespace v1
     {
-      typedef one_of<letter, digit> alphanum;
+      typedef
+        accept_when<
+          one_char,
+          util::in_char_class<
+            char_class_union<
+              char_class_union<
+                char_class_range_c<'a', 'z'>,
+                char_class_range_c<'A', 'Z'>
+              >,
+              char_class_range_c<'0', '9'>
+            >
+          >,
+          error::none_of_the_expected_cases_found
+        >
+        alphanum;
     }
   }
 }
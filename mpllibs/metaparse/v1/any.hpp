@@ -6,11 +6,11 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <mpllibs/metaparse/v1/foldr.hpp>
+#include <mpllibs/metaparse/v1/impl/any_impl.hpp>
+#include <mpllibs/metaparse/v1/impl/iterate_chunk.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
 
-#include <boost/mpl/vector.hpp>
-#include <boost/mpl/push_front.hpp>
-#include <boost/mpl/lambda.hpp>
+#include <boost/mpl/list.hpp>
 
 namespace mpllibs
 {
@@ -19,15 +19,21 @@ namespace mpllibs
     namespace v1
     {
       template <class P>
-      struct any :
-        foldr<
-          P,
-          boost::mpl::vector<>,
-          typename boost::mpl::lambda<
-            boost::mpl::push_front<boost::mpl::_2, boost::mpl::_1>
-          >::type
-        >
-      {};
+      struct any
+      {
+        typedef any type;
+
+        template <class S, class Pos>
+        struct apply :
+          impl::any_impl<
+            1,
+            P,
+            impl::iterate_running<boost::mpl::list<>, S, Pos>
+          >
+        {
+          MPLLIBS_METAPARSE_TRACE_APPLY(any, S, Pos)
+        };
+      };
     }
   }
 }
@@ -6,11 +6,11 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <mpllibs/metaparse/v1/foldr1.hpp>
+#include <mpllibs/metaparse/v1/any.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
 
-#include <boost/mpl/vector.hpp>
-#include <boost/mpl/push_front.hpp>
-#include <boost/mpl/lambda.hpp>
+#include <boost/mpl/apply.hpp>
+#include <boost/mpl/eval_if.hpp>
 
 namespace mpllibs
 {
@@ -19,15 +19,19 @@ namespace mpllibs
     namespace v1
     {
       template <class P>
-      struct any1 :
-        foldr1<
-          P,
-          boost::mpl::vector<>,
-          boost::mpl::lambda<
-            boost::mpl::push_front<boost::mpl::_2, boost::mpl::_1>
-          >::type
-        >
-      {};
+      struct any1
+      {
+        typedef any1 type;
+
+        template <class S, class Pos>
+        struct apply :
+          boost::mpl::eval_if<
+            typename is_error<boost::mpl::apply<P, S, Pos> >::type,
+            boost::mpl::apply<P, S, Pos>,
+            boost::mpl::apply<any<P>, S, Pos>
+          >
+        {};
+      };
     }
   }
 }
@@ -8,6 +8,8 @@
 
 #include <mpllibs/metaparse/v1/impl/one_of.hpp>
 #include <mpllibs/metaparse/v1/any.hpp>
+#include <mpllibs/metaparse/v1/error/none_of_the_expected_cases_found.hpp>
+#include <mpllibs/metaparse/v1/fail.hpp>
 
 #include <boost/preprocessor/arithmetic/sub.hpp>
 #include <boost/preprocessor/repetition/enum.hpp>
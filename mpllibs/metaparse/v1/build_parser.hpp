@@ -14,6 +14,7 @@
 #include <mpllibs/metaparse/v1/get_line.hpp>
 #include <mpllibs/metaparse/v1/get_col.hpp>
 #include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
 
 #include <boost/mpl/apply.hpp>
 #include <boost/mpl/eval_if.hpp>
@@ -52,7 +53,14 @@ namespace mpllibs
             >,
             get_result<boost::mpl::apply<P, S, start> >
           >
-        {};
+        {
+        #ifdef MPLLIBS_METAPARSE_TRACE
+        private:
+          typedef typename boost::mpl::apply<P, S, start>::type parse_result;
+        public:
+          MPLLIBS_METAPARSE_TRACE_RESULT(P, S, start, parse_result)
+        #endif
+        };
       };
     }
   }
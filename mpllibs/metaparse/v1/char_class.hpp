@@ -0,0 +1,61 @@
+#ifndef MPLLIBS_METAPARSE_V1_CHAR_CLASS_HPP
+#define MPLLIBS_METAPARSE_V1_CHAR_CLASS_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/accept_when.hpp>
+#include <mpllibs/metaparse/v1/one_char.hpp>
+#include <mpllibs/metaparse/v1/error/unexpected_character.hpp>
+#include <mpllibs/metaparse/v1/util/in_char_class.hpp>
+#include <mpllibs/metaparse/v1/impl/char_class_word.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum_params_with_a_default.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      template <
+        BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(
+          MPLLIBS_CHAR_CLASS_WORDS,
+          unsigned long W,
+          0
+        )
+      >
+      struct char_class
+      {
+        typedef char_class type;
+
+        #ifdef MPLLIBS_CHAR_CLASS_WORD
+        #  error MPLLIBS_CHAR_CLASS_WORD already defined
+        #endif
+        #define MPLLIBS_CHAR_CLASS_WORD(z, n, unused) \
+          static const unsigned long BOOST_PP_CAT(word, n) = \
+            BOOST_PP_CAT(W, n) & 0xfffffffful;
+
+        BOOST_PP_REPEAT(MPLLIBS_CHAR_CLASS_WORDS, MPLLIBS_CHAR_CLASS_WORD, ~)
+
+        #undef MPLLIBS_CHAR_CLASS_WORD
+
+        template <class S, class Pos>
+        struct apply :
+          accept_when<
+            one_char,
+            util::in_char_class<char_class>,
+            error::unexpected_character
+          >::template apply<S, Pos>
+        {};
+      };
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,65 @@
+#ifndef MPLLIBS_METAPARSE_V1_CHAR_CLASS_C_HPP
+#define MPLLIBS_METAPARSE_V1_CHAR_CLASS_C_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/char_class.hpp>
+#include <mpllibs/metaparse/v1/impl/char_class_word.hpp>
+#include <mpllibs/metaparse/limit_char_class_size.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/enum_params_with_a_default.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+#include <climits>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      #ifdef MPLLIBS_CHAR_CLASS_C_BIT
+      #  error MPLLIBS_CHAR_CLASS_C_BIT already defined
+      #endif
+      #define MPLLIBS_CHAR_CLASS_C_BIT(z, n, word) \
+        | impl::char_class_char_word<word, BOOST_PP_CAT(C, n)>::value
+
+      #ifdef MPLLIBS_CHAR_CLASS_C_WORD
+      #  error MPLLIBS_CHAR_CLASS_C_WORD already defined
+      #endif
+      #define MPLLIBS_CHAR_CLASS_C_WORD(z, n, unused) \
+        0ul \
+        BOOST_PP_REPEAT( \
+          MPLLIBS_LIMIT_CHAR_CLASS_SIZE, \
+          MPLLIBS_CHAR_CLASS_C_BIT, \
+          n \
+        )
+
+      // The characters C1 ... Cn. The unused arguments are LONG_MAX, which
+      // is not a character and is ignored.
+      template <
+        BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(
+          MPLLIBS_LIMIT_CHAR_CLASS_SIZE,
+          long C,
+          LONG_MAX
+        )
+      >
+      struct char_class_c :
+        char_class<
+          BOOST_PP_ENUM(MPLLIBS_CHAR_CLASS_WORDS, MPLLIBS_CHAR_CLASS_C_WORD, ~)
+        >
+      {};
+
+      #undef MPLLIBS_CHAR_CLASS_C_WORD
+      #undef MPLLIBS_CHAR_CLASS_C_BIT
+    }
+  }
+}
+
+#endif
+
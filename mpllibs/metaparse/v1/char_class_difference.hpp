@@ -0,0 +1,44 @@
+#ifndef MPLLIBS_METAPARSE_V1_CHAR_CLASS_DIFFERENCE_HPP
+#define MPLLIBS_METAPARSE_V1_CHAR_CLASS_DIFFERENCE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/char_class.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      #ifdef MPLLIBS_CHAR_CLASS_DIFFERENCE_WORD
+      #  error MPLLIBS_CHAR_CLASS_DIFFERENCE_WORD already defined
+      #endif
+      #define MPLLIBS_CHAR_CLASS_DIFFERENCE_WORD(z, n, unused) \
+        A::BOOST_PP_CAT(word, n) & ~B::BOOST_PP_CAT(word, n)
+
+      // The characters in A but not in B
+      template <class A, class B>
+      struct char_class_difference :
+        char_class<
+          BOOST_PP_ENUM(
+            MPLLIBS_CHAR_CLASS_WORDS,
+            MPLLIBS_CHAR_CLASS_DIFFERENCE_WORD,
+            ~
+          )
+        >
+      {};
+
+      #undef MPLLIBS_CHAR_CLASS_DIFFERENCE_WORD
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,44 @@
+#ifndef MPLLIBS_METAPARSE_V1_CHAR_CLASS_RANGE_C_HPP
+#define MPLLIBS_METAPARSE_V1_CHAR_CLASS_RANGE_C_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/char_class.hpp>
+#include <mpllibs/metaparse/v1/impl/char_class_word.hpp>
+
+#include <boost/preprocessor/repetition/enum.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      #ifdef MPLLIBS_CHAR_CLASS_RANGE_C_WORD
+      #  error MPLLIBS_CHAR_CLASS_RANGE_C_WORD already defined
+      #endif
+      #define MPLLIBS_CHAR_CLASS_RANGE_C_WORD(z, n, unused) \
+        impl::char_class_char_range_word<n, From, To>::value
+
+      // The characters From-To
+      template <char From, char To>
+      struct char_class_range_c :
+        char_class<
+          BOOST_PP_ENUM(
+            MPLLIBS_CHAR_CLASS_WORDS,
+            MPLLIBS_CHAR_CLASS_RANGE_C_WORD,
+            ~
+          )
+        >
+      {};
+
+      #undef MPLLIBS_CHAR_CLASS_RANGE_C_WORD
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,48 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_ANY_HPP
+#define MPLLIBS_METAPARSE_V1_CX_ANY_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/foldl.hpp>
+#include <boost/mpl/int.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        namespace impl
+        {
+          struct count_applications
+          {
+            template <class T>
+            static constexpr int apply(int count_, T)
+            {
+              return count_ + 1;
+            }
+          };
+        }
+
+        // The result is the number of times P was applied. It is a foldl,
+        // therefore it fails when P succeeds without consuming any input.
+        template <class P>
+        struct any :
+          foldl<P, boost::mpl::int_<0>, impl::count_applications>
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,65 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_BUILD_PARSER_HPP
+#define MPLLIBS_METAPARSE_V1_CX_BUILD_PARSER_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+#include <mpllibs/metaparse/v1/cx/impl/run_on_string.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/integral_c.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        // Instantiated when parsing fails, Pos is the position of the
+        // error in the input
+        template <int Pos>
+        struct x__________________PARSING_FAILED__________________x
+        {
+          static_assert(
+            Pos == Pos + 1,
+            "Parsing failed at the position given to the template argument"
+            " of x__________________PARSING_FAILED__________________x"
+          );
+        };
+
+        // Lifts the result of P into a type. P has to have an integral
+        // value_type.
+        template <class P>
+        struct build_parser
+        {
+          typedef build_parser type;
+
+          template <class S>
+          struct apply :
+            boost::mpl::eval_if_c<
+              impl::run_on_string<P, S>().success,
+              boost::mpl::integral_c<
+                typename P::value_type,
+                impl::run_on_string<P, S>().value
+              >,
+              x__________________PARSING_FAILED__________________x<
+                impl::run_on_string<P, S>().pos
+              >
+            >::type
+          {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,143 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_FOLDL_HPP
+#define MPLLIBS_METAPARSE_V1_CX_FOLDL_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        // State is a class with a value_type and a static constant value (eg.
+        // boost::mpl::int_). ForwardOp is a class with a static constexpr apply
+        // function taking the state and the result of P.
+        //
+        // P is applied in chunks: the chunks are 1, 2, 4, ... applications
+        // long and the applications of a chunk are split into two halves
+        // recursively, thus the depth of the recursion grows logarithmically
+        // with the number of applications. When P succeeds without consuming
+        // any input, foldl fails at that position, since it would never
+        // stop.
+        template <class P, class State, class ForwardOp>
+        struct foldl
+        {
+          typedef typename State::value_type value_type;
+
+          // The state of the folding after a number of applications. done
+          // is set when P has failed or has not consumed any input.
+          struct chunk
+          {
+            constexpr chunk(
+              bool success_,
+              bool done_,
+              value_type state_,
+              int pos_
+            ) :
+              success(success_),
+              done(done_),
+              state(state_),
+              pos(pos_)
+            {}
+
+            bool success;
+            bool done;
+            value_type state;
+            int pos;
+          };
+
+          static constexpr result<value_type> run(
+            const char* s_,
+            int len_,
+            int pos_
+          )
+          {
+            return
+              run_chunks(chunk(true, false, State::value, pos_), s_, len_, 0);
+          }
+
+          // Applies the chunks of 2^n_, 2^(n_ + 1), ... applications
+          static constexpr result<value_type> run_chunks(
+            chunk c_,
+            const char* s_,
+            int len_,
+            int n_
+          )
+          {
+            return
+              c_.done ?
+                (
+                  c_.success ?
+                    accept(c_.state, c_.pos) :
+                    reject<value_type>(c_.pos)
+                ) :
+                run_chunks(apply_chunk(c_, s_, len_, n_), s_, len_, n_ + 1);
+          }
+
+          // Applies P at most 2^n_ times
+          static constexpr chunk apply_chunk(
+            chunk c_,
+            const char* s_,
+            int len_,
+            int n_
+          )
+          {
+            return
+              n_ == 0 ?
+                apply_once(c_, P::run(s_, len_, c_.pos)) :
+                apply_second_half(
+                  apply_chunk(c_, s_, len_, n_ - 1),
+                  s_,
+                  len_,
+                  n_ - 1
+                );
+          }
+
+          static constexpr chunk apply_second_half(
+            chunk c_,
+            const char* s_,
+            int len_,
+            int n_
+          )
+          {
+            return c_.done ? c_ : apply_chunk(c_, s_, len_, n_);
+          }
+
+          static constexpr chunk apply_once(
+            chunk c_,
+            result<typename P::value_type> r_
+          )
+          {
+            return
+              !r_.success ?
+                chunk(true, true, c_.state, c_.pos) :
+                (
+                  r_.pos == c_.pos ?
+                    chunk(false, true, c_.state, c_.pos) :
+                    chunk(
+                      true,
+                      false,
+                      ForwardOp::apply(c_.state, r_.value),
+                      r_.pos
+                    )
+                );
+          }
+        };
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
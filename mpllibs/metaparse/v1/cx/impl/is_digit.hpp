@@ -0,0 +1,36 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_IMPL_IS_DIGIT_HPP
+#define MPLLIBS_METAPARSE_V1_CX_IMPL_IS_DIGIT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/config.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        namespace impl
+        {
+          constexpr bool is_digit(char c_)
+          {
+            return '0' <= c_ && c_ <= '9';
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,36 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_IMPL_IS_WHITESPACE_HPP
+#define MPLLIBS_METAPARSE_V1_CX_IMPL_IS_WHITESPACE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/config.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        namespace impl
+        {
+          constexpr bool is_whitespace(char c_)
+          {
+            return c_ == ' ' || c_ == '\t' || c_ == '\n' || c_ == '\r';
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,45 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_IMPL_RUN_ON_STRING_HPP
+#define MPLLIBS_METAPARSE_V1_CX_IMPL_RUN_ON_STRING_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+#include <mpllibs/metaparse/v1/string.hpp>
+#include <boost/mpl/size.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        namespace impl
+        {
+          // Applies P to a compile-time string
+          template <class P, class S>
+          constexpr result<typename P::value_type> run_on_string()
+          {
+            return
+              P::run(
+                boost::mpl::c_str<S>::value,
+                boost::mpl::size<S>::type::value,
+                0
+              );
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,55 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_INT__HPP
+#define MPLLIBS_METAPARSE_V1_CX_INT__HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+#include <mpllibs/metaparse/v1/cx/impl/is_digit.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        struct int_
+        {
+          typedef int value_type;
+
+          static constexpr result<int> run(const char* s_, int len_, int pos_)
+          {
+            return
+              pos_ < len_ && impl::is_digit(s_[pos_]) ?
+                digits(0, s_, len_, pos_) :
+                reject<int>(pos_);
+          }
+
+          static constexpr result<int> digits(
+            int value_,
+            const char* s_,
+            int len_,
+            int pos_
+          )
+          {
+            return
+              pos_ < len_ && impl::is_digit(s_[pos_]) ?
+                digits(value_ * 10 + (s_[pos_] - '0'), s_, len_, pos_ + 1) :
+                accept(value_, pos_);
+          }
+        };
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
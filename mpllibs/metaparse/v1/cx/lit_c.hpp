@@ -0,0 +1,42 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_LIT_C_HPP
+#define MPLLIBS_METAPARSE_V1_CX_LIT_C_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        template <char C>
+        struct lit_c
+        {
+          typedef char value_type;
+
+          static constexpr result<char> run(const char* s_, int len_, int pos_)
+          {
+            return
+              pos_ < len_ && s_[pos_] == C ?
+                accept(C, pos_ + 1) :
+                reject<char>(pos_);
+          }
+        };
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
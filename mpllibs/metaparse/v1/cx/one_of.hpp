@@ -0,0 +1,60 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_ONE_OF_HPP
+#define MPLLIBS_METAPARSE_V1_CX_ONE_OF_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        // The parsers have to have the same value_type
+        template <class... Ps>
+        struct one_of;
+
+        template <class P>
+        struct one_of<P> : P {};
+
+        template <class P, class... Ps>
+        struct one_of<P, Ps...>
+        {
+          typedef typename P::value_type value_type;
+
+          static constexpr result<value_type> run(
+            const char* s_,
+            int len_,
+            int pos_
+          )
+          {
+            return first_or_rest(P::run(s_, len_, pos_), s_, len_, pos_);
+          }
+
+          static constexpr result<value_type> first_or_rest(
+            result<value_type> r_,
+            const char* s_,
+            int len_,
+            int pos_
+          )
+          {
+            return r_.success ? r_ : one_of<Ps...>::run(s_, len_, pos_);
+          }
+        };
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,35 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_PARSE_HPP
+#define MPLLIBS_METAPARSE_V1_CX_PARSE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        // Applies P to a string literal
+        template <class P, int N>
+        constexpr result<typename P::value_type> parse(const char (&s_)[N])
+        {
+          return P::run(s_, N - 1, 0);
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
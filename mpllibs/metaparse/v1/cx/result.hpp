@@ -0,0 +1,59 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_RESULT_HPP
+#define MPLLIBS_METAPARSE_V1_CX_RESULT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/config.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        // The result of applying a constexpr parser. When parsing succeeds,
+        // pos is the position of the first character not consumed by the
+        // parser, otherwise it is the position where parsing failed.
+        template <class T>
+        struct result
+        {
+          typedef T value_type;
+
+          constexpr result(bool success_, T value_, int pos_) :
+            success(success_),
+            value(value_),
+            pos(pos_)
+          {}
+
+          bool success;
+          T value;
+          int pos;
+        };
+
+        template <class T>
+        constexpr result<T> accept(T value_, int pos_)
+        {
+          return result<T>(true, value_, pos_);
+        }
+
+        template <class T>
+        constexpr result<T> reject(int pos_)
+        {
+          return result<T>(false, T(), pos_);
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,89 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_SEQUENCE_HPP
+#define MPLLIBS_METAPARSE_V1_CX_SEQUENCE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+#include <mpllibs/metaparse/v1/cx/values.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        template <class... Ps>
+        struct sequence;
+
+        template <>
+        struct sequence<>
+        {
+          typedef values<> value_type;
+
+          static constexpr result<value_type> run(const char*, int, int pos_)
+          {
+            return accept(value_type(), pos_);
+          }
+        };
+
+        template <class P, class... Ps>
+        struct sequence<P, Ps...>
+        {
+          typedef
+            values<typename P::value_type, typename Ps::value_type...>
+            value_type;
+
+          typedef result<typename P::value_type> head_result;
+          typedef result<typename sequence<Ps...>::value_type> tail_result;
+
+          static constexpr result<value_type> run(
+            const char* s_,
+            int len_,
+            int pos_
+          )
+          {
+            return parse_tail(P::run(s_, len_, pos_), s_, len_);
+          }
+
+          static constexpr result<value_type> parse_tail(
+            head_result head_,
+            const char* s_,
+            int len_
+          )
+          {
+            return
+              head_.success ?
+                combine(
+                  head_.value,
+                  sequence<Ps...>::run(s_, len_, head_.pos)
+                ) :
+                reject<value_type>(head_.pos);
+          }
+
+          static constexpr result<value_type> combine(
+            typename P::value_type head_,
+            tail_result tail_
+          )
+          {
+            return
+              tail_.success ?
+                accept(value_type(head_, tail_.value), tail_.pos) :
+                reject<value_type>(tail_.pos);
+          }
+        };
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,86 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_TOKEN_HPP
+#define MPLLIBS_METAPARSE_V1_CX_TOKEN_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/cx/result.hpp>
+#include <mpllibs/metaparse/v1/cx/impl/is_whitespace.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        template <class P>
+        struct token
+        {
+          typedef typename P::value_type value_type;
+
+          static constexpr result<value_type> run(
+            const char* s_,
+            int len_,
+            int pos_
+          )
+          {
+            return skip_whitespaces(P::run(s_, len_, pos_), s_, len_);
+          }
+
+          static constexpr result<value_type> skip_whitespaces(
+            result<value_type> r_,
+            const char* s_,
+            int len_
+          )
+          {
+            return
+              r_.success ?
+                accept(r_.value, whitespaces_end(s_, len_, r_.pos)) :
+                r_;
+          }
+
+          // The halves of the range are checked recursively, thus the depth
+          // of the recursion grows logarithmically with the length of the
+          // input
+          static constexpr int whitespaces_end(
+            const char* s_,
+            int len_,
+            int pos_
+          )
+          {
+            return
+              len_ - pos_ < 2 ?
+                (pos_ < len_ && impl::is_whitespace(s_[pos_]) ? len_ : pos_) :
+                whitespaces_end_in_second_half(
+                  s_,
+                  len_,
+                  whitespaces_end(s_, (pos_ + len_) / 2, pos_),
+                  (pos_ + len_) / 2
+                );
+          }
+
+          static constexpr int whitespaces_end_in_second_half(
+            const char* s_,
+            int len_,
+            int end_,
+            int middle_
+          )
+          {
+            return end_ < middle_ ? end_ : whitespaces_end(s_, len_, middle_);
+          }
+        };
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,84 @@
+#ifndef MPLLIBS_METAPARSE_V1_CX_VALUES_HPP
+#define MPLLIBS_METAPARSE_V1_CX_VALUES_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/config.hpp>
+
+#ifdef MPLLIBS_CONSTEXPR_PARSERS
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace cx
+      {
+        // The result of sequence
+        template <class... Ts>
+        struct values;
+
+        template <>
+        struct values<>
+        {
+          constexpr values() {}
+        };
+
+        template <class T, class... Ts>
+        struct values<T, Ts...>
+        {
+          constexpr values() : head(), tail() {}
+
+          constexpr values(T head_, values<Ts...> tail_) :
+            head(head_),
+            tail(tail_)
+          {}
+
+          T head;
+          values<Ts...> tail;
+        };
+
+        template <int N, class V>
+        struct value_at;
+
+        template <class T, class... Ts>
+        struct value_at<0, values<T, Ts...> >
+        {
+          typedef T type;
+
+          static constexpr type get(values<T, Ts...> v_)
+          {
+            return v_.head;
+          }
+        };
+
+        template <int N, class T, class... Ts>
+        struct value_at<N, values<T, Ts...> >
+        {
+          typedef typename value_at<N - 1, values<Ts...> >::type type;
+
+          static constexpr type get(values<T, Ts...> v_)
+          {
+            return value_at<N - 1, values<Ts...> >::get(v_.tail);
+          }
+        };
+
+        template <int N, class... Ts>
+        constexpr
+        typename value_at<N, values<Ts...> >::type get(values<Ts...> v_)
+        {
+          return value_at<N, values<Ts...> >::get(v_);
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+#endif
+
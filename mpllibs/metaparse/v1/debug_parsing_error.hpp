@@ -8,14 +8,11 @@
 
 #include <mpllibs/metaparse/v1/fwd/build_parser.hpp>
 #include <mpllibs/metaparse/v1/start.hpp>
-#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/impl/debug_report.hpp>
 
 #include <boost/mpl/apply.hpp>
-#include <boost/mpl/if.hpp>
-#include <boost/mpl/string.hpp>
 
 #include <iostream>
-#include <cstdlib>
 
 namespace mpllibs
 {
@@ -29,66 +26,25 @@ namespace mpllibs
       public:
         debug_parsing_error()
         {
-          using std::cout;
-          using std::endl;
-          using boost::mpl::c_str;
-          using boost::mpl::apply;
-        
-          typedef display<typename apply<P, S, start>::type> runner;
-            
-          cout << "Compile-time parsing results" << endl;
-          cout << "----------------------------" << endl;
-          cout << "Input text:" << endl;
-          cout << c_str<S>::type::value << endl;
-          cout << endl;
-          runner::run();
-          
-          exit(0);
+          run(std::cout);
+        }
+
+        explicit debug_parsing_error(std::ostream& o_)
+        {
+          run(o_);
         }
       
         typedef debug_parsing_error type;
       private:
-        template <class Result>
-        struct display_error
+        // The text of the report is generated at compile-time
+        static void run(std::ostream& o_)
         {
-          static void run()
-          {
-            typedef typename Result::type R;
-
-            std::cout
-              << "Parsing failed:" << std::endl
-              << "line " << get_line<typename R::source_position>::type::value
-              << ", col " << get_col<typename R::source_position>::type::value
-              << ": "
-              << R::message::type::get_value() << std::endl;
-          }
-        };
-        
-        template <class Result>
-        struct display_no_error
-        {
-          static void run()
-          {
-            using std::cout;
-            using std::endl;
-            using boost::mpl::c_str;
-            
-            typedef typename get_remaining<Result>::type remaining_string;
-            
-            cout
-              << "Parsing was successful. Remaining string is:" << endl
-              << c_str<remaining_string>::type::value << endl;
-          }
-        };
-
-        template <class Result>
-        struct display :
-          boost::mpl::if_<
-            typename is_error<Result>::type,
-            display_error<Result>,
-            display_no_error<Result>
-          >::type
-        {};
+          impl::debug_report<
+            S,
+            start,
+            typename boost::mpl::apply<P, S, start>::type
+          >(o_);
+        }
       };
 
       // Special case to handle when DebugParsingError is used with build_parser
@@ -96,7 +52,14 @@ namespace mpllibs
       template <class P, class S>
       class debug_parsing_error<build_parser<P>, S> :
         debug_parsing_error<P, S>
-      {};
+      {
+      public:
+        debug_parsing_error() {}
+
+        explicit debug_parsing_error(std::ostream& o_) :
+          debug_parsing_error<P, S>(o_)
+        {}
+      };
     }
   }
 }
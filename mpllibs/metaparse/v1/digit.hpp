@@ -10,7 +10,8 @@
 #include <mpllibs/metaparse/v1/accept_when.hpp>
 #include <mpllibs/metaparse/v1/one_char.hpp>
 
-#include <mpllibs/metaparse/v1/util/is_digit.hpp>
+#include <mpllibs/metaparse/v1/char_class_range_c.hpp>
+#include <mpllibs/metaparse/v1/util/in_char_class.hpp>
 
 namespace mpllibs
 {
@@ -19,7 +20,11 @@ namespace mpllibs
     namespace v1
     {
       typedef
-        accept_when<one_char, util::is_digit<>, error::digit_expected>
+        accept_when<
+          one_char,
+          util::in_char_class<char_class_range_c<'0', '9'> >,
+          error::digit_expected
+        >
         digit;
     }
   }
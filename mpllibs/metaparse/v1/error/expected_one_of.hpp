@@ -0,0 +1,75 @@
+#ifndef MPLLIBS_METAPARSE_V1_ERROR_EXPECTED_ONE_OF_HPP
+#define MPLLIBS_METAPARSE_V1_ERROR_EXPECTED_ONE_OF_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/error_message_text.hpp>
+
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/next.hpp>
+
+#include <string>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class Begin, class End>
+        struct join_error_messages
+        {
+          static std::string run(const std::string& separator_)
+          {
+            return
+              separator_
+              + error_message_text<
+                  typename boost::mpl::deref<Begin>::type
+                >::run()
+              + join_error_messages<
+                  typename boost::mpl::next<Begin>::type,
+                  End
+                >::run("; ");
+          }
+        };
+
+        template <class End>
+        struct join_error_messages<End, End>
+        {
+          static std::string run(const std::string&)
+          {
+            return "";
+          }
+        };
+      }
+
+      namespace error
+      {
+        template <class Messages>
+        struct expected_one_of
+        {
+          typedef expected_one_of type;
+
+          static std::string get_value()
+          {
+            return
+              "None of the expected cases found"
+              + impl::join_error_messages<
+                  typename boost::mpl::begin<Messages>::type,
+                  typename boost::mpl::end<Messages>::type
+                >::run(": ");
+          }
+        };
+      }
+    }
+  }
+}
+
+#endif
+
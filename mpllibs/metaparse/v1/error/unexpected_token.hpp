@@ -0,0 +1,26 @@
+#ifndef MPLLIBS_METAPARSE_V1_ERROR_UNEXPECTED_TOKEN_HPP
+#define MPLLIBS_METAPARSE_V1_ERROR_UNEXPECTED_TOKEN_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/define_error.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace error
+      {
+        MPLLIBS_V1_DEFINE_ERROR(unexpected_token, "Unexpected token");
+      }
+    }
+  }
+}
+
+#endif
+
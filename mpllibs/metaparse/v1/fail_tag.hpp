@@ -11,8 +11,6 @@
 #include <mpllibs/metaparse/v1/fwd/get_message.hpp>
 #include <mpllibs/metaparse/v1/fwd/get_position.hpp>
 
-#include <iostream>
-
 namespace mpllibs
 {
   namespace metaparse
@@ -8,6 +8,15 @@
 
 #include <mpllibs/metaparse/v1/nth_of.hpp>
 
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/punctuation/comma_if.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/enum_params_with_a_default.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/arithmetic/sub.hpp>
+#include <boost/preprocessor/tuple/eat.hpp>
+
 namespace mpllibs
 {
   namespace metaparse
@@ -21,9 +30,30 @@ namespace mpllibs
           boost::mpl::na
         )
       >
-      struct first_of :
-        nth_of_c<0, BOOST_PP_ENUM_PARAMS(MPLLIBS_LIMIT_SEQUENCE_SIZE, P)>
-      {};
+      struct first_of;
+
+      #ifdef MPLLIBS_FIRST_OF_N
+      #  error MPLLIBS_FIRST_OF_N already defined
+      #endif
+      #define MPLLIBS_FIRST_OF_N(z, n, unused) \
+        template <BOOST_PP_ENUM_PARAMS(n, class P)> \
+        struct first_of< \
+          BOOST_PP_ENUM_PARAMS(n, P) \
+          BOOST_PP_COMMA_IF(n) \
+          BOOST_PP_ENUM( \
+            BOOST_PP_SUB(MPLLIBS_LIMIT_SEQUENCE_SIZE, n), \
+            boost::mpl::na BOOST_PP_TUPLE_EAT(3), \
+            ~ \
+          ) \
+        > : \
+          impl::BOOST_PP_CAT(nth_of_c, n)< \
+            0 BOOST_PP_COMMA_IF(n) BOOST_PP_ENUM_PARAMS(n, P) \
+          > \
+        {};
+      
+      BOOST_PP_REPEAT(MPLLIBS_LIMIT_SEQUENCE_SIZE, MPLLIBS_FIRST_OF_N, ~)
+      
+      #undef MPLLIBS_FIRST_OF_N
     }
   }
 }
@@ -11,6 +11,7 @@
 #include <mpllibs/metaparse/v1/get_position.hpp>
 #include <mpllibs/metaparse/v1/get_result.hpp>
 #include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
 
 #include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/apply.hpp>
@@ -46,6 +47,10 @@ namespace mpllibs
             typename get_position<Res>::type
           >
         {};
+
+        // The state changes in every iteration, it is not used to identify
+        // the parser in the trace
+        typedef foldl<P, boost::mpl::na, ForwardOp> trace_id;
       public:
         typedef foldl type;
       
@@ -56,7 +61,9 @@ namespace mpllibs
             boost::mpl::apply_wrap2<return_<typename State::type>, S, Pos>,
             apply_unchecked<boost::mpl::apply<P, S, Pos> >
           >
-        {};
+        {
+          MPLLIBS_METAPARSE_TRACE_APPLY(trace_id, S, Pos)
+        };
       };
     }
   }
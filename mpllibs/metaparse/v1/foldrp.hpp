@@ -11,6 +11,7 @@
 #include <mpllibs/metaparse/v1/get_position.hpp>
 #include <mpllibs/metaparse/v1/get_result.hpp>
 #include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
 
 #include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/apply.hpp>
@@ -74,7 +75,9 @@ namespace mpllibs
             boost::mpl::apply<StateP, S, Pos>,
             apply_unchecked<boost::mpl::apply<P, S, Pos> >
           >
-        {};
+        {
+          MPLLIBS_METAPARSE_TRACE_APPLY(foldrp, S, Pos)
+        };
       };
     }
   }
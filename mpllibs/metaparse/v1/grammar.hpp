@@ -26,17 +26,18 @@
 #include <mpllibs/metaparse/v1/entire_input.hpp>
 #include <mpllibs/metaparse/v1/string.hpp>
 
+#include <mpllibs/metamonad/dict.hpp>
+#include <mpllibs/metamonad/dict_at.hpp>
+#include <mpllibs/metamonad/dict_has_key.hpp>
+#include <mpllibs/metamonad/dict_insert.hpp>
+
 #include <boost/mpl/apply_wrap.hpp>
-#include <boost/mpl/at.hpp>
-#include <boost/mpl/map.hpp>
 #include <boost/mpl/eval_if.hpp>
-#include <boost/mpl/has_key.hpp>
 #include <boost/mpl/lambda.hpp>
 #include <boost/mpl/push_front.hpp>
 #include <boost/mpl/front.hpp>
 #include <boost/mpl/back.hpp>
 #include <boost/mpl/pair.hpp>
-#include <boost/mpl/insert.hpp>
 
 /*
  * The grammar
@@ -136,7 +137,7 @@ namespace mpllibs
         {
           typedef
             boost::mpl::apply_wrap1<
-              typename boost::mpl::at<typename G::rules, Name>::type,
+              typename metamonad::dict_at<typename G::rules, Name>::type,
               G
             >
             p;
@@ -146,8 +147,11 @@ namespace mpllibs
         
           typedef
             typename boost::mpl::eval_if<
-              typename boost::mpl::has_key<typename G::actions, Name>::type,
-              impl<boost::mpl::at<typename G::actions, Name> >,
+              typename metamonad::dict_has_key<
+                typename G::actions,
+                Name
+              >::type,
+              impl<metamonad::dict_at<typename G::actions, Name> >,
               p
             >::type
             type;
@@ -342,7 +346,11 @@ namespace mpllibs
         struct add_rule<grammar_builder<Start, Rules, Actions>, P, no_action> :
           grammar_builder<
             Start,
-            typename boost::mpl::insert<Rules, typename P::type>::type,
+            typename metamonad::dict_insert<
+              Rules,
+              typename P::name,
+              typename P::the_parser
+            >::type,
             Actions
           >
         {};
@@ -351,15 +359,16 @@ namespace mpllibs
         struct add_rule<grammar_builder<Start, Rules, Actions>, P, F> :
           grammar_builder<
             Start,
-            typename boost::mpl::insert<Rules, typename P::type>::type,
-            typename boost::mpl::insert<
+            typename metamonad::dict_insert<
+              Rules,
+              typename P::name,
+              typename P::the_parser
+            >::type,
+            typename metamonad::dict_insert<
               Actions,
-              boost::mpl::pair<
-                typename P::name,
-                typename boost::mpl::lambda<F>::type
-              >
-            >
-            ::type
+              typename P::name,
+              typename boost::mpl::lambda<F>::type
+            >::type
           >
         {};
         
@@ -367,9 +376,10 @@ namespace mpllibs
         struct add_import<grammar_builder<Start, Rules, Actions>, Name, P> :
           grammar_builder<
             Start,
-            typename boost::mpl::insert<
+            typename metamonad::dict_insert<
               Rules,
-              boost::mpl::pair<Name, build_native_parser<P> >
+              Name,
+              build_native_parser<P>
             >::type,
             Actions
           >
@@ -380,8 +390,8 @@ namespace mpllibs
       struct grammar :
         grammar_util::grammar_builder<
           Start,
-          boost::mpl::map<>,
-          boost::mpl::map<>
+          metamonad::dict,
+          metamonad::dict
         >
       {};
     }
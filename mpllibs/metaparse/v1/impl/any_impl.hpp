@@ -0,0 +1,45 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_ANY_IMPL_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_ANY_IMPL_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/iterate_chunk.hpp>
+#include <mpllibs/metaparse/v1/impl/reverse_list.hpp>
+#include <mpllibs/metaparse/v1/return_.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Applies P in chunks of N, 2 * N, 4 * N, ... applications until it
+        // fails, thus the depth of the template instantiations is
+        // logarithmic in the number of accepted elements.
+        template <int N, class P, class State>
+        struct any_impl :
+          any_impl<N * 2, P, typename iterate_chunk<N, P, State>::type>
+        {};
+
+        template <int N, class P, class Accum, class S, class Pos, class E>
+        struct any_impl<N, P, iterate_stopped<Accum, S, Pos, E> > :
+          boost::mpl::apply_wrap2<
+            return_<typename reverse_list<Accum>::type>,
+            S,
+            Pos
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
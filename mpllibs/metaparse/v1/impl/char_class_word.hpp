@@ -0,0 +1,89 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_CHAR_CLASS_WORD_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_CHAR_CLASS_WORD_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * A character class is a set of 256 bits, one for each value of unsigned
+ * char. It is stored in 8 words of 32 bits, the bit of character code C is
+ * bit C % 32 of word C / 32.
+ */
+
+#ifdef MPLLIBS_CHAR_CLASS_WORDS
+#  error MPLLIBS_CHAR_CLASS_WORDS already defined
+#endif
+#define MPLLIBS_CHAR_CLASS_WORDS 8
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The bits of the character codes From-To in word I
+        template <int I, int From, int To>
+        struct char_class_range_word
+        {
+          static const int first = From < I * 32 ? 0 : From - I * 32;
+          static const int last = To > I * 32 + 31 ? 31 : To - I * 32;
+
+          static const unsigned long value =
+            (first > last || first > 31 || last < 0) ?
+              0ul :
+              (
+                (last == 31 ? 0xfffffffful : (1ul << ((last + 1) & 31)) - 1)
+                & ~((1ul << (first & 31)) - 1)
+                & 0xfffffffful
+              );
+        };
+
+        // The bit of the character C in word I. Values that are not
+        // characters are ignored.
+        template <int I, long C>
+        struct char_class_char_word
+        {
+          static const int code = static_cast<int>(C & 255);
+
+          static const unsigned long value =
+            (-128 <= C && C <= 255 && code / 32 == I) ?
+              1ul << (code % 32) :
+              0ul;
+        };
+
+        // The bits of the characters From-To in word I. When char is signed
+        // and the range contains both negative and non-negative values, the
+        // codes of the characters form two ranges.
+        template <int I, char From, char To>
+        struct char_class_char_range_word
+        {
+          static const int from_code = static_cast<unsigned char>(From);
+          static const int to_code = static_cast<unsigned char>(To);
+
+          static const unsigned long value =
+            From > To ?
+              0ul :
+              (
+                char_class_range_word<
+                  I,
+                  from_code,
+                  (from_code <= to_code ? to_code : 255)
+                >::value
+                | char_class_range_word<
+                  I,
+                  (from_code <= to_code ? 256 : 0),
+                  to_code
+                >::value
+              );
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -8,15 +8,16 @@
 
 #include <mpllibs/metaparse/config.hpp>
 #include <mpllibs/metaparse/v1/fwd/string.hpp>
+#include <mpllibs/metaparse/v1/impl/size.hpp>
+#include <mpllibs/metaparse/v1/impl/no_char.hpp>
 
-#include <boost/preprocessor/arithmetic/dec.hpp>
-#include <boost/preprocessor/arithmetic/inc.hpp>
 #include <boost/preprocessor/arithmetic/mul.hpp>
 #include <boost/preprocessor/arithmetic/sub.hpp>
-#include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/punctuation/comma_if.hpp>
 #include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/tuple/eat.hpp>
 
 namespace mpllibs
 {
@@ -33,59 +34,60 @@ namespace mpllibs
         template <char... As, char... Bs>
         struct concat<string<As...>, string<Bs...>> : string<As..., Bs...> {};
 #else
-        template <class A, class B>
+        // N is the length of A. The result is built in one step: the first
+        // N characters of A are followed by the characters of B. B has to
+        // fit into the rest of the string, otherwise there is no matching
+        // specialisation.
+        template <int N, class A, class B>
         struct concat_impl;
 
-        #ifdef MPLLIBS_ARG
-        #  error MPLLIBS_ARG already defined
-        #endif
-        #define MPLLIBS_ARG(z, n, unused) BOOST_PP_CAT(B, BOOST_PP_INC(n))
-
         #ifdef MPLLIBS_CONCAT
         #  error MPLLIBS_CONCAT already defined
         #endif
         #define MPLLIBS_CONCAT(z, n, unused) \
           template < \
-            BOOST_PP_ENUM_PARAMS(n, int A) BOOST_PP_COMMA_IF(n) \
-            BOOST_PP_ENUM_PARAMS(MPLLIBS_LIMIT_STRING_SIZE, int B) \
+            BOOST_PP_ENUM_PARAMS(MPLLIBS_LIMIT_STRING_SIZE, int A), \
+            BOOST_PP_ENUM_PARAMS( \
+              BOOST_PP_SUB(MPLLIBS_LIMIT_STRING_SIZE, n), \
+              int B \
+            ) \
           > \
           struct \
             concat_impl< \
+              n, \
+              string<BOOST_PP_ENUM_PARAMS(MPLLIBS_LIMIT_STRING_SIZE, A)>, \
               string< \
-                BOOST_PP_ENUM_PARAMS(n, A) \
-                BOOST_PP_COMMA_IF( \
-                  BOOST_PP_MUL(BOOST_PP_SUB(MPLLIBS_LIMIT_STRING_SIZE, n), n) \
-                ) \
-                BOOST_PP_ENUM( \
+                BOOST_PP_ENUM_PARAMS( \
                   BOOST_PP_SUB(MPLLIBS_LIMIT_STRING_SIZE, n), \
-                  MPLLIBS_NO_CHAR BOOST_PP_TUPLE_EAT(3), \
-                  ~ \
+                  B \
                 ) \
-              >, \
-              string<BOOST_PP_ENUM_PARAMS(MPLLIBS_LIMIT_STRING_SIZE, B)> \
-            > : \
-            concat< \
-              string<BOOST_PP_ENUM_PARAMS(n, A) BOOST_PP_COMMA_IF(n) B0>, \
-              string< \
-                BOOST_PP_ENUM( \
-                  BOOST_PP_DEC(MPLLIBS_LIMIT_STRING_SIZE), \
-                  MPLLIBS_ARG, \
-                  ~ \
+                BOOST_PP_COMMA_IF( \
+                  BOOST_PP_MUL(BOOST_PP_SUB(MPLLIBS_LIMIT_STRING_SIZE, n), n) \
                 ) \
+                BOOST_PP_ENUM(n, MPLLIBS_NO_CHAR BOOST_PP_TUPLE_EAT(3), ~) \
               > \
+            > : \
+            string< \
+              BOOST_PP_ENUM_PARAMS(n, A) \
+              BOOST_PP_COMMA_IF( \
+                BOOST_PP_MUL(BOOST_PP_SUB(MPLLIBS_LIMIT_STRING_SIZE, n), n) \
+              ) \
+              BOOST_PP_ENUM_PARAMS( \
+                BOOST_PP_SUB(MPLLIBS_LIMIT_STRING_SIZE, n), \
+                B \
+              ) \
             > \
           {};
 
         BOOST_PP_REPEAT(MPLLIBS_LIMIT_STRING_SIZE, MPLLIBS_CONCAT, ~)
 
-        #undef MPLLIBS_ARG
         #undef MPLLIBS_CONCAT
 
         template <class S>
         struct concat<S, string<> > : S {};
 
         template <class A, class B>
-        struct concat : concat_impl<A, B> {};
+        struct concat : concat_impl<size<A>::type::value, A, B> {};
 #endif
       }
     }
@@ -0,0 +1,232 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_DEBUG_REPORT_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_DEBUG_REPORT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/debug_segment.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/get_line.hpp>
+#include <mpllibs/metaparse/v1/get_col.hpp>
+
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/string.hpp>
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#ifdef MPLLIBS_METAPARSE_TRACE
+
+#include <mpllibs/metaparse/v1/next_char.hpp>
+
+#include <boost/core/demangle.hpp>
+
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/pop_front.hpp>
+
+#include <cstring>
+#include <typeinfo>
+#include <vector>
+
+#endif
+
+/*
+ * The report of debug_parsing_error is made of constant tables initialised at
+ * compile-time: string literals, the tables of the strings and the decimal
+ * form of the positions. Only the error message (which is a runtime value by
+ * the protocol of the errors) and the parser applications recorded at program
+ * startup are not known at compile-time.
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class S>
+        struct debug_header
+        {
+          static const debug_segment value[3];
+        };
+
+        template <class S>
+        const debug_segment debug_header<S>::value[3] =
+          {
+            MPLLIBS_METAPARSE_DEBUG_TEXT(
+              "Compile-time parsing results\n"
+              "----------------------------\n"
+              "Input text:\n"
+            ),
+            {
+              boost::mpl::c_str<S>::type::value,
+              boost::mpl::size<S>::type::value
+            },
+            MPLLIBS_METAPARSE_DEBUG_TEXT("\n\n")
+          };
+
+        template <class Result, bool Error = is_error<Result>::type::value>
+        struct debug_result
+        {
+          static const debug_segment value[3];
+
+          static void write_message(std::streambuf&) {}
+        };
+
+        template <class Result, bool Error>
+        const debug_segment debug_result<Result, Error>::value[3] =
+          {
+            MPLLIBS_METAPARSE_DEBUG_TEXT(
+              "Parsing was successful. Remaining string is:\n"
+            ),
+            {
+              boost::mpl::c_str<
+                typename get_remaining<Result>::type
+              >::type::value,
+              boost::mpl::size<
+                typename get_remaining<Result>::type
+              >::type::value
+            },
+            MPLLIBS_METAPARSE_DEBUG_TEXT("\n")
+          };
+
+        template <class Result>
+        struct debug_result<Result, true>
+        {
+          static const debug_segment value[5];
+
+          static void write_message(std::streambuf& b_)
+          {
+            const std::string msg = Result::type::message::type::get_value();
+            b_.sputn(msg.data(), msg.size());
+            b_.sputc('\n');
+          }
+        };
+
+        template <class Result>
+        const debug_segment debug_result<Result, true>::value[5] =
+          {
+            MPLLIBS_METAPARSE_DEBUG_TEXT("Parsing failed:\nline "),
+            MPLLIBS_METAPARSE_DEBUG_DECIMAL(
+              get_line<typename Result::type::source_position>::type::value
+            ),
+            MPLLIBS_METAPARSE_DEBUG_TEXT(", col "),
+            MPLLIBS_METAPARSE_DEBUG_DECIMAL(
+              get_col<typename Result::type::source_position>::type::value
+            ),
+            MPLLIBS_METAPARSE_DEBUG_TEXT(": ")
+          };
+
+#ifdef MPLLIBS_METAPARSE_TRACE
+        // Displays the parser applications recorded for the suffixes of S
+        // in the order of the suffixes
+        template <
+          class S,
+          class Pos,
+          bool Empty = boost::mpl::empty<S>::type::value
+        >
+        struct debug_trace
+        {
+          static void write(std::streambuf& b_)
+          {
+            debug_trace<S, Pos, true>::write(b_);
+            debug_trace<
+              typename boost::mpl::pop_front<S>::type,
+              typename next_char<
+                Pos,
+                typename boost::mpl::front<S>::type
+              >::type
+            >::write(b_);
+          }
+        };
+
+        template <class S, class Pos>
+        struct debug_trace<S, Pos, true>
+        {
+          static void write(std::streambuf& b_)
+          {
+            const std::vector<trace_entry>& log = trace_log();
+            for (
+              std::vector<trace_entry>::const_iterator
+                i = log.begin(),
+                e = log.end();
+              i != e;
+              ++i
+            )
+            {
+              if (
+                i->start_line == get_line<Pos>::type::value
+                && i->start_col == get_col<Pos>::type::value
+                && *i->input == typeid(S)
+              )
+              {
+                const boost::core::scoped_demangled_name
+                  name(i->parser->name());
+                const char* n = name.get() ? name.get() : i->parser->name();
+
+                b_.sputn("  ", 2);
+                debug_write(b_, *i->text);
+                b_.sputn(n, std::strlen(n));
+                b_.sputc('\n');
+              }
+            }
+          }
+        };
+
+        template <class S, class Pos>
+        void debug_write_trace(std::streambuf& b_)
+        {
+          static const debug_segment
+            title = MPLLIBS_METAPARSE_DEBUG_TEXT("Parser applications:\n");
+
+          b_.sputn(title.text, title.length);
+          debug_trace<S, Pos>::write(b_);
+        }
+#else
+        template <class S, class Pos>
+        void debug_write_trace(std::streambuf& b_)
+        {
+          static const debug_segment
+            note =
+              MPLLIBS_METAPARSE_DEBUG_TEXT(
+                "Define MPLLIBS_METAPARSE_TRACE to display the parser"
+                " applications\n"
+              );
+
+          b_.sputn(note.text, note.length);
+        }
+#endif
+
+        // Writes the report of parsing S, starting at Pos, with the result
+        // Result to o_
+        template <class S, class Pos, class Result>
+        void debug_report(std::ostream& o_)
+        {
+          const std::ostream::sentry s(o_);
+          if (s)
+          {
+            std::streambuf& b = *o_.rdbuf();
+
+            debug_write(b, debug_header<S>::value);
+            debug_write_trace<S, Pos>(b);
+            b.sputc('\n');
+            debug_write(b, debug_result<Result>::value);
+            debug_result<Result>::write_message(b);
+          }
+          o_.flush();
+        }
+      }
+    }
+  }
+}
+
+#endif
+
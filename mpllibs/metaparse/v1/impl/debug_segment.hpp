@@ -0,0 +1,125 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_DEBUG_SEGMENT_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_DEBUG_SEGMENT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/preprocessor/repetition/enum.hpp>
+
+#include <streambuf>
+
+/*
+ * The text of the debugging reports is made of segments: constant tables
+ * initialised at compile-time and their lengths. The numbers displayed are
+ * turned into decimal tables at compile-time as well.
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct debug_segment
+        {
+          const char* text;
+          int length;
+        };
+
+        template <int N>
+        struct debug_pow10
+        {
+          static const int value = 10 * debug_pow10<N - 1>::value;
+        };
+
+        template <>
+        struct debug_pow10<0>
+        {
+          static const int value = 1;
+        };
+
+        // N is not negative
+        template <int N, bool OneDigit = (N < 10)>
+        struct debug_digit_count
+        {
+          static const int value = 1 + debug_digit_count<N / 10>::value;
+        };
+
+        template <int N>
+        struct debug_digit_count<N, true>
+        {
+          static const int value = 1;
+        };
+
+        // Character I of the decimal form of N, 0 after its last digit
+        template <
+          int N,
+          int I,
+          int Length = debug_digit_count<N>::value,
+          bool Digit = (I < Length)
+        >
+        struct debug_digit
+        {
+          static const char
+            value = char('0' + N / debug_pow10<Length - 1 - I>::value % 10);
+        };
+
+        template <int N, int I, int Length>
+        struct debug_digit<N, I, Length, false>
+        {
+          static const char value = 0;
+        };
+
+        template <int N>
+        struct debug_decimal
+        {
+          static const int length = debug_digit_count<N>::value;
+          static const char value[11];
+        };
+
+        #ifdef MPLLIBS_DEBUG_DIGIT
+        #  error MPLLIBS_DEBUG_DIGIT already defined
+        #endif
+        #define MPLLIBS_DEBUG_DIGIT(z, n, unused) debug_digit<N, n>::value
+
+        template <int N>
+        const char debug_decimal<N>::value[11] =
+          {BOOST_PP_ENUM(10, MPLLIBS_DEBUG_DIGIT, ~), 0};
+
+        #undef MPLLIBS_DEBUG_DIGIT
+
+        template <int N>
+        void debug_write(std::streambuf& b_, const debug_segment (&s_)[N])
+        {
+          for (int i = 0; i != N; ++i)
+          {
+            b_.sputn(s_[i].text, s_[i].length);
+          }
+        }
+      }
+    }
+  }
+}
+
+// The segment of a string literal
+#ifdef MPLLIBS_METAPARSE_DEBUG_TEXT
+#  error MPLLIBS_METAPARSE_DEBUG_TEXT already defined
+#endif
+#define MPLLIBS_METAPARSE_DEBUG_TEXT(s) {s, sizeof(s) - 1}
+
+// The segment of the decimal form of n (n is not negative)
+#ifdef MPLLIBS_METAPARSE_DEBUG_DECIMAL
+#  error MPLLIBS_METAPARSE_DEBUG_DECIMAL already defined
+#endif
+#define MPLLIBS_METAPARSE_DEBUG_DECIMAL(n) \
+  { \
+    ::mpllibs::metaparse::v1::impl::debug_decimal<(n)>::value, \
+    ::mpllibs::metaparse::v1::impl::debug_decimal<(n)>::length \
+  }
+
+#endif
+
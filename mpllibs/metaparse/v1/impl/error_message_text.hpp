@@ -0,0 +1,90 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_ERROR_MESSAGE_TEXT_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_ERROR_MESSAGE_TEXT_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/has_xxx.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+#include <string>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(has_message_type, type, false)
+
+        template <class T, std::string (*)()>
+        struct get_value_address;
+
+        template <class Msg>
+        struct has_get_value
+        {
+          typedef char yes;
+          typedef char (&no)[2];
+
+          template <class T>
+          static yes test(get_value_address<T, &T::get_value>*);
+
+          template <class T>
+          static no test(...);
+
+          static const bool value = sizeof(test<Msg>(0)) == sizeof(yes);
+        };
+
+        // Messages are not required to provide a text. They may be
+        // metafunctions returning an error providing it.
+        template <
+          class Msg,
+          bool HasGetValue = has_get_value<Msg>::value,
+          bool HasType = has_message_type<Msg>::value
+        >
+        struct error_message_text
+        {
+          static std::string run()
+          {
+            return Msg::get_value();
+          }
+        };
+
+        template <class Msg, bool Evaluated = false>
+        struct error_message_type_text :
+          error_message_text<typename Msg::type>
+        {};
+
+        template <class Msg>
+        struct error_message_type_text<Msg, true>
+        {
+          static std::string run()
+          {
+            return "Unknown error";
+          }
+        };
+
+        template <class Msg>
+        struct error_message_text<Msg, false, true> :
+          error_message_type_text<
+            Msg,
+            boost::is_same<Msg, typename Msg::type>::value
+          >
+        {};
+
+        template <class Msg>
+        struct error_message_text<Msg, false, false> :
+          error_message_type_text<Msg, true>
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,39 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_FURTHER_POSITION_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_FURTHER_POSITION_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/get_col.hpp>
+#include <mpllibs/metaparse/v1/get_line.hpp>
+
+#include <boost/mpl/bool.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Source position A is after source position B
+        template <class A, class B>
+        struct further_position :
+          boost::mpl::bool_<
+            (get_line<A>::type::value > get_line<B>::type::value)
+            || (
+              get_line<A>::type::value == get_line<B>::type::value
+              && get_col<A>::type::value > get_col<B>::type::value
+            )
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
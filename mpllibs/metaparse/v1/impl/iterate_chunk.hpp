@@ -0,0 +1,106 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_ITERATE_CHUNK_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_ITERATE_CHUNK_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/get_result.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+
+#include <boost/mpl/apply.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/push_front.hpp>
+
+/*
+ * Repeated application of a parser
+ *
+ * A chunk of N applications is split into two chunks of N / 2 and N - N / 2
+ * applications. The second one starts from the state the first one has
+ * stopped in. The depth of the template instantiations is logarithmic in
+ * the number of applications, thus long repetitions don't hit the
+ * instantiation depth limit of the compiler.
+ *
+ * The results are collected by pushing them to the front of a list, which
+ * is cheap for long lists as well. The list is reversed once when the
+ * repetition is over.
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Accum is the list of the results so far in reverse order, the
+        // parser can be applied to S at Pos again
+        template <class Accum, class S, class Pos>
+        struct iterate_running
+        {
+          typedef iterate_running type;
+        };
+
+        // The parser returned Error when it was applied to S at Pos
+        template <class Accum, class S, class Pos, class Error>
+        struct iterate_stopped
+        {
+          typedef iterate_stopped type;
+        };
+
+        template <class Accum, class R>
+        struct iterate_accepted :
+          iterate_running<
+            typename boost::mpl::push_front<
+              Accum,
+              typename get_result<R>::type
+            >::type,
+            typename get_remaining<R>::type,
+            typename get_position<R>::type
+          >
+        {};
+
+        // Applies P at most N times starting from State
+        template <int N, class P, class State>
+        struct iterate_chunk :
+          iterate_chunk<
+            N - N / 2,
+            P,
+            typename iterate_chunk<N / 2, P, State>::type
+          >
+        {};
+
+        template <int N, class P, class Accum, class S, class Pos, class E>
+        struct iterate_chunk<N, P, iterate_stopped<Accum, S, Pos, E> > :
+          iterate_stopped<Accum, S, Pos, E>
+        {};
+
+        template <class P, class Accum, class S, class Pos>
+        struct iterate_chunk<0, P, iterate_running<Accum, S, Pos> > :
+          iterate_running<Accum, S, Pos>
+        {};
+
+        template <class P, class Accum, class S, class Pos>
+        struct iterate_chunk<1, P, iterate_running<Accum, S, Pos> > :
+          boost::mpl::eval_if<
+            typename is_error<boost::mpl::apply<P, S, Pos> >::type,
+            iterate_stopped<
+              Accum,
+              S,
+              Pos,
+              typename boost::mpl::apply<P, S, Pos>::type
+            >,
+            iterate_accepted<Accum, boost::mpl::apply<P, S, Pos> >
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
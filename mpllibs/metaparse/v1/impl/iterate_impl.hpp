@@ -6,12 +6,11 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <mpllibs/metaparse/v1/impl/iterate_impl_unchecked.hpp>
+#include <mpllibs/metaparse/v1/impl/iterate_chunk.hpp>
+#include <mpllibs/metaparse/v1/impl/reverse_list.hpp>
 #include <mpllibs/metaparse/v1/return_.hpp>
-#include <mpllibs/metaparse/v1/is_error.hpp>
 
-#include <boost/mpl/eval_if.hpp>
-#include <boost/mpl/apply.hpp>
+#include <boost/mpl/apply_wrap.hpp>
 
 namespace mpllibs
 {
@@ -21,23 +20,40 @@ namespace mpllibs
     {
       namespace impl
       {
+        template <class State>
+        struct iterate_impl_result;
+
+        template <class Accum, class S, class Pos>
+        struct iterate_impl_result<iterate_running<Accum, S, Pos> > :
+          boost::mpl::apply_wrap2<
+            return_<typename reverse_list<Accum>::type>,
+            S,
+            Pos
+          >
+        {};
+
+        template <class Accum, class S, class Pos, class Error>
+        struct iterate_impl_result<iterate_stopped<Accum, S, Pos, Error> >
+        {
+          typedef Error type;
+        };
+
         template <int N, class P, class Accum>
         struct iterate_impl
         {
           typedef iterate_impl type;
-          
+
           template <class S, class Pos>
           struct apply :
-            boost::mpl::eval_if<
-              typename is_error<boost::mpl::apply<P, S, Pos> >::type,
-              boost::mpl::apply<P, S, Pos>,
-              iterate_impl_unchecked<N, P, Accum, S, Pos>
+            iterate_impl_result<
+              typename iterate_chunk<
+                N,
+                P,
+                iterate_running<Accum, S, Pos>
+              >::type
             >
           {};
         };
-        
-        template <class P, class Accum>
-        struct iterate_impl<0, P, Accum> : return_<Accum> {};
       }
     }
   }
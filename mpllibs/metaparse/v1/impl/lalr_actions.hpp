@@ -0,0 +1,313 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_LALR_ACTIONS_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_LALR_ACTIONS_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/lalr_grammar_info.hpp>
+#include <mpllibs/metaparse/v1/impl/lalr_automaton.hpp>
+#include <mpllibs/metaparse/v1/impl/lalr_lookaheads.hpp>
+
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/erase_key.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/vector.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class State>
+        struct lalr_shift;
+
+        template <class ProductionIndex>
+        struct lalr_reduce;
+
+        struct lalr_accept;
+
+        template <class G>
+        struct lalr_keep_precedence
+        {
+          typedef lalr_keep_precedence type;
+
+          template <class Precedence, class X>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::mpl::has_key<typename G::precedence, X>::type,
+              boost::mpl::at<typename G::precedence, X>,
+              boost::mpl::identity<Precedence>
+            >
+          {};
+        };
+
+        // The precedence of the last terminal with a precedence in the rule
+        template <class G, class ProductionIndex>
+        struct lalr_rule_precedence :
+          boost::mpl::fold<
+            typename boost::mpl::at<
+              typename G::productions,
+              ProductionIndex
+            >::type::rhs,
+            lalr_no_precedence,
+            lalr_keep_precedence<G>
+          >
+        {};
+
+        template <class G, class X>
+        struct lalr_terminal_precedence :
+          lalr_keep_precedence<G>::template apply<lalr_no_precedence, X>
+        {};
+
+        // Choice is lalr_left when the reduction is kept, lalr_right when the
+        // shift is kept and lalr_nonassoc when none of them is kept
+        template <class Actions, class X, class Reduce, class Choice>
+        struct lalr_choose
+        {
+          typedef Actions type;
+        };
+
+        template <class Actions, class X, class Reduce>
+        struct lalr_choose<Actions, X, Reduce, lalr_left> :
+          boost::mpl::insert<
+            typename boost::mpl::erase_key<Actions, X>::type,
+            boost::mpl::pair<X, Reduce>
+          >
+        {};
+
+        template <class Actions, class X, class Reduce>
+        struct lalr_choose<Actions, X, Reduce, lalr_nonassoc> :
+          boost::mpl::erase_key<Actions, X>
+        {};
+
+        // Without precedence information the shift is kept
+        template <
+          class Actions,
+          class X,
+          class Reduce,
+          class RulePrecedence,
+          class TerminalPrecedence
+        >
+        struct lalr_resolve_shift_reduce
+        {
+          typedef Actions type;
+        };
+
+        template <
+          class Actions,
+          class X,
+          class Reduce,
+          class RuleLevel,
+          class RuleAssoc,
+          class Level,
+          class Assoc
+        >
+        struct lalr_resolve_shift_reduce<
+          Actions,
+          X,
+          Reduce,
+          lalr_precedence<RuleLevel, RuleAssoc>,
+          lalr_precedence<Level, Assoc>
+        > :
+          lalr_choose<
+            Actions,
+            X,
+            Reduce,
+            typename boost::mpl::if_c<
+              (RuleLevel::type::value > Level::type::value),
+              lalr_left,
+              typename boost::mpl::if_c<
+                (RuleLevel::type::value < Level::type::value),
+                lalr_right,
+                Assoc
+              >::type
+            >::type
+          >
+        {};
+
+        // Reduce-reduce conflicts are resolved by keeping the earlier rule
+        template <class G, class Actions, class X, class P, class Current>
+        struct lalr_resolve
+        {
+          typedef Actions type;
+        };
+
+        template <class G, class Actions, class X, class P, class State>
+        struct lalr_resolve<G, Actions, X, P, lalr_shift<State> > :
+          lalr_resolve_shift_reduce<
+            Actions,
+            X,
+            lalr_reduce<P>,
+            typename lalr_rule_precedence<G, P>::type,
+            typename lalr_terminal_precedence<G, X>::type
+          >
+        {};
+
+        template <class G, class P>
+        struct lalr_add_reduce
+        {
+          typedef lalr_add_reduce type;
+
+          template <class Actions, class X>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::mpl::has_key<Actions, X>::type,
+              lalr_resolve<
+                G,
+                Actions,
+                X,
+                P,
+                typename boost::mpl::at<Actions, X>::type
+              >,
+              boost::mpl::insert<Actions, boost::mpl::pair<X, lalr_reduce<P> > >
+            >
+          {};
+        };
+
+        template <class G, class Lookaheads>
+        struct lalr_add_reductions
+        {
+          typedef lalr_add_reductions type;
+
+          template <class Actions, class Item>
+          struct reductions :
+            boost::mpl::eval_if_c<
+              lalr_item_info<G, Item>::production_index::value == 0,
+              boost::mpl::insert<
+                Actions,
+                boost::mpl::pair<lalr_end, lalr_accept>
+              >,
+              boost::mpl::fold<
+                typename lalr_lookahead_at<
+                  Lookaheads,
+                  typename lalr_item_info<G, Item>::lookahead_key
+                >::type,
+                Actions,
+                lalr_add_reduce<
+                  G,
+                  typename lalr_item_info<G, Item>::production_index
+                >
+              >
+            >
+          {};
+
+          template <class Actions, class Item>
+          struct apply :
+            boost::mpl::eval_if<
+              typename lalr_item_info<G, Item>::complete,
+              reductions<Actions, Item>,
+              boost::mpl::identity<Actions>
+            >
+          {};
+        };
+
+        template <class G>
+        struct lalr_add_shift
+        {
+          typedef lalr_add_shift type;
+
+          template <class Actions, class Transition>
+          struct apply :
+            boost::mpl::eval_if<
+              typename lalr_is_nonterminal<
+                G,
+                typename Transition::first
+              >::type,
+              boost::mpl::identity<Actions>,
+              boost::mpl::insert<
+                Actions,
+                boost::mpl::pair<
+                  typename Transition::first,
+                  lalr_shift<typename Transition::second>
+                >
+              >
+            >
+          {};
+        };
+
+        template <class Actions>
+        struct lalr_add_expected
+        {
+          typedef lalr_add_expected type;
+
+          template <class Terminals, class X>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::mpl::has_key<Actions, X>::type,
+              boost::mpl::push_back<Terminals, X>,
+              boost::mpl::identity<Terminals>
+            >
+          {};
+        };
+
+        // The parsing table of a grammar
+        template <class G>
+        struct lalr_table
+        {
+          typedef lalr_table type;
+
+          typedef G grammar;
+          typedef typename lalr_build_automaton<G>::type automaton;
+          typedef typename lalr_lookaheads<G, automaton>::type lookaheads;
+        };
+
+        // The actions of state I of table T. Only the states the parser
+        // reaches are calculated.
+        template <class T, class I>
+        struct lalr_state
+        {
+          typedef typename T::grammar g;
+
+          // A map from terminals to lalr_shift, lalr_reduce or lalr_accept
+          typedef
+            typename boost::mpl::fold<
+              typename boost::mpl::at<typename T::automaton::states, I>::type,
+              typename boost::mpl::fold<
+                typename boost::mpl::at<
+                  typename T::automaton::transitions,
+                  I
+                >::type,
+                boost::mpl::map<>,
+                lalr_add_shift<g>
+              >::type,
+              lalr_add_reductions<
+                g,
+                typename boost::mpl::at<typename T::lookaheads, I>::type
+              >
+            >::type
+            actions;
+
+          // The terminals having an action in the order they appear in the
+          // grammar
+          typedef
+            typename boost::mpl::fold<
+              typename g::terminals,
+              boost::mpl::vector<>,
+              lalr_add_expected<actions>
+            >::type
+            expected;
+
+          typedef
+            typename boost::mpl::at<typename T::automaton::transitions, I>::type
+            transitions;
+        };
+      }
+    }
+  }
+}
+
+#endif
+
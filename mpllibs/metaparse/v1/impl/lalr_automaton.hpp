@@ -0,0 +1,357 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_LALR_AUTOMATON_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_LALR_AUTOMATON_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/lalr_grammar_info.hpp>
+
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/contains.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/list.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/pair.hpp>
+#include <boost/mpl/pop_front.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/range_c.hpp>
+#include <boost/mpl/set.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class Item, class Items>
+        struct lalr_goes_before_front :
+          boost::mpl::bool_<
+            (Item::type::value < boost::mpl::front<Items>::type::value)
+          >
+        {};
+
+        template <class Items, class Item>
+        struct lalr_insert_item;
+
+        template <class Items, class Item>
+        struct lalr_insert_item_after_front :
+          boost::mpl::push_front<
+            typename lalr_insert_item<
+              typename boost::mpl::pop_front<Items>::type,
+              Item
+            >::type,
+            typename boost::mpl::front<Items>::type
+          >
+        {};
+
+        // Kernels are sorted lists of items built by push_front, thus the
+        // same kernel is always represented by the same type
+        template <class Items, class Item>
+        struct lalr_insert_item :
+          boost::mpl::eval_if<
+            typename boost::mpl::or_<
+              boost::mpl::empty<Items>,
+              lalr_goes_before_front<Item, Items>
+            >::type,
+            boost::mpl::push_front<Items, Item>,
+            lalr_insert_item_after_front<Items, Item>
+          >
+        {};
+
+        template <class G>
+        struct lalr_add_left_corners
+        {
+          typedef lalr_add_left_corners type;
+
+          template <class Nonterminals, class Item>
+          struct apply :
+            boost::mpl::eval_if<
+              typename lalr_is_nonterminal<
+                G,
+                typename lalr_item_info<G, Item>::next_symbol
+              >::type,
+              lalr_union<
+                Nonterminals,
+                typename lalr_left_corners<
+                  G,
+                  typename lalr_item_info<G, Item>::next_symbol
+                >::type
+              >,
+              boost::mpl::identity<Nonterminals>
+            >
+          {};
+        };
+
+        // The nonterminals whose rules are added to Kernel by the closure
+        template <class G, class Kernel>
+        struct lalr_closure_nonterminals :
+          boost::mpl::fold<Kernel, boost::mpl::set<>, lalr_add_left_corners<G> >
+        {};
+
+        template <class G, class Nonterminals>
+        struct lalr_add_closure_item
+        {
+          typedef lalr_add_closure_item type;
+
+          template <class Items, class N>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::mpl::has_key<
+                Nonterminals,
+                typename boost::mpl::at<typename G::productions, N>::type::lhs
+              >::type,
+              boost::mpl::push_back<Items, boost::mpl::int_<N::value * 256> >,
+              boost::mpl::identity<Items>
+            >
+          {};
+        };
+
+        template <class G, class Kernel>
+        struct lalr_closure :
+          boost::mpl::fold<
+            boost::mpl::range_c<
+              int,
+              0,
+              boost::mpl::size<typename G::productions>::type::value
+            >,
+            typename boost::mpl::fold<
+              Kernel,
+              boost::mpl::vector<>,
+              boost::mpl::push_back<boost::mpl::_1, boost::mpl::_2>
+            >::type,
+            lalr_add_closure_item<
+              G,
+              typename lalr_closure_nonterminals<G, Kernel>::type
+            >
+          >
+        {};
+
+        template <class G>
+        struct lalr_add_next_symbol
+        {
+          typedef lalr_add_next_symbol type;
+
+          template <class Symbols, class Item>
+          struct apply
+          {
+            typedef typename lalr_item_info<G, Item>::next_symbol x;
+
+            typedef
+              typename boost::mpl::eval_if<
+                typename boost::mpl::or_<
+                  boost::is_same<x, lalr_no_symbol>,
+                  boost::mpl::contains<Symbols, x>
+                >::type,
+                boost::mpl::identity<Symbols>,
+                boost::mpl::push_back<Symbols, x>
+              >::type
+              type;
+          };
+        };
+
+        template <class G, class X>
+        struct lalr_add_advanced_item
+        {
+          typedef lalr_add_advanced_item type;
+
+          template <class Kernel, class Item>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::is_same<
+                typename lalr_item_info<G, Item>::next_symbol,
+                X
+              >::type,
+              lalr_insert_item<
+                Kernel,
+                typename lalr_item_info<G, Item>::advanced
+              >,
+              boost::mpl::identity<Kernel>
+            >
+          {};
+        };
+
+        template <class G, class Closure, class X>
+        struct lalr_goto_kernel :
+          boost::mpl::fold<
+            Closure,
+            boost::mpl::list<>,
+            lalr_add_advanced_item<G, X>
+          >
+        {};
+
+        template <class States, class Transitions>
+        struct lalr_automaton
+        {
+          typedef lalr_automaton type;
+
+          // The kernel of each state
+          typedef States states;
+          // A map from symbols to state indices for each state
+          typedef Transitions transitions;
+        };
+
+        template <class States, class Index, class Map>
+        struct lalr_new_transitions
+        {
+          typedef lalr_new_transitions type;
+
+          typedef States states;
+          typedef Index index;
+          typedef Map map;
+        };
+
+        template <class States, class Index, class Kernel>
+        struct lalr_add_state
+        {
+          typedef boost::mpl::int_<boost::mpl::size<States>::type::value> id;
+
+          typedef typename boost::mpl::push_back<States, Kernel>::type states;
+          typedef
+            typename boost::mpl::insert<
+              Index,
+              boost::mpl::pair<Kernel, id>
+            >::type
+            index;
+        };
+
+        template <class States, class Index, class Kernel>
+        struct lalr_existing_state
+        {
+          typedef typename boost::mpl::at<Index, Kernel>::type id;
+
+          typedef States states;
+          typedef Index index;
+        };
+
+        template <class G, class Closure>
+        struct lalr_add_transition
+        {
+          typedef lalr_add_transition type;
+
+          template <class T, class X>
+          struct apply
+          {
+            typedef typename lalr_goto_kernel<G, Closure, X>::type kernel;
+            typedef typename T::states states;
+            typedef typename T::index index;
+
+            typedef
+              typename boost::mpl::if_<
+                typename boost::mpl::has_key<index, kernel>::type,
+                lalr_existing_state<states, index, kernel>,
+                lalr_add_state<states, index, kernel>
+              >::type
+              target;
+
+            typedef
+              lalr_new_transitions<
+                typename target::states,
+                typename target::index,
+                typename boost::mpl::insert<
+                  typename T::map,
+                  boost::mpl::pair<X, typename target::id>
+                >::type
+              >
+              type;
+          };
+        };
+
+        template <class G, class States, class Index, class Transitions>
+        struct lalr_build_states;
+
+        template <class G, class States, class Index, class Transitions>
+        struct lalr_build_next_state
+        {
+          typedef
+            typename lalr_closure<
+              G,
+              typename boost::mpl::at<
+                States,
+                typename boost::mpl::size<Transitions>::type
+              >::type
+            >::type
+            closure;
+
+          typedef
+            typename boost::mpl::fold<
+              typename boost::mpl::fold<
+                closure,
+                boost::mpl::vector<>,
+                lalr_add_next_symbol<G>
+              >::type,
+              lalr_new_transitions<States, Index, boost::mpl::map<> >,
+              lalr_add_transition<G, closure>
+            >::type
+            next;
+
+          typedef
+            typename lalr_build_states<
+              G,
+              typename next::states,
+              typename next::index,
+              typename boost::mpl::push_back<
+                Transitions,
+                typename next::map
+              >::type
+            >::type
+            type;
+        };
+
+        // Processes the states one by one. Transitions has an element for
+        // each processed state.
+        template <class G, class States, class Index, class Transitions>
+        struct lalr_build_states :
+          boost::mpl::eval_if_c<
+            boost::mpl::size<States>::type::value
+              == boost::mpl::size<Transitions>::type::value,
+            lalr_automaton<States, Transitions>,
+            lalr_build_next_state<G, States, Index, Transitions>
+          >
+        {};
+
+        // The LR(0) automaton of the grammar. State 0 is the initial state.
+        template <class G>
+        struct lalr_build_automaton
+        {
+          typedef
+            typename lalr_insert_item<
+              boost::mpl::list<>,
+              boost::mpl::int_<0>
+            >::type
+            initial;
+
+          typedef
+            typename lalr_build_states<
+              G,
+              boost::mpl::vector<initial>,
+              boost::mpl::map<boost::mpl::pair<initial, boost::mpl::int_<0> > >,
+              boost::mpl::vector<>
+            >::type
+            type;
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,319 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_LALR_GRAMMAR_INFO_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_LALR_GRAMMAR_INFO_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/contains.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/list.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/pop_front.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/set.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The left hand side of the rule added to the grammar to start
+        // parsing with and the terminal symbol marking the end of the input
+        struct lalr_start;
+        struct lalr_end;
+
+        struct lalr_no_action;
+        struct lalr_no_symbol;
+
+        template <class Lhs, class Rhs, class Action>
+        struct lalr_production
+        {
+          typedef lalr_production type;
+
+          typedef Lhs lhs;
+          typedef Rhs rhs;
+          typedef Action action;
+        };
+
+        // Precedence of the terminal symbols
+        struct lalr_left;
+        struct lalr_right;
+        struct lalr_nonassoc;
+        struct lalr_no_precedence;
+
+        template <class Level, class Assoc>
+        struct lalr_precedence
+        {
+          typedef lalr_precedence type;
+
+          typedef Level level;
+          typedef Assoc assoc;
+        };
+
+        template <class Productions, class Imports, class Precedence>
+        struct lalr_grammar_info
+        {
+          typedef lalr_grammar_info type;
+
+          typedef Productions productions;
+          typedef Imports imports;
+          typedef Precedence precedence;
+
+          struct add_lhs
+          {
+            typedef add_lhs type;
+
+            template <class Nonterminals, class P>
+            struct apply : boost::mpl::insert<Nonterminals, typename P::lhs> {};
+          };
+
+          typedef
+            typename boost::mpl::fold<
+              Productions,
+              boost::mpl::set<>,
+              add_lhs
+            >::type
+            nonterminals;
+
+          struct add_terminal
+          {
+            typedef add_terminal type;
+
+            template <class Terminals, class X>
+            struct apply :
+              boost::mpl::eval_if<
+                typename boost::mpl::or_<
+                  boost::mpl::has_key<nonterminals, X>,
+                  boost::mpl::contains<Terminals, X>
+                >::type,
+                boost::mpl::identity<Terminals>,
+                boost::mpl::push_back<Terminals, X>
+              >
+            {};
+          };
+
+          struct add_terminals
+          {
+            typedef add_terminals type;
+
+            template <class Terminals, class P>
+            struct apply :
+              boost::mpl::fold<typename P::rhs, Terminals, add_terminal>
+            {};
+          };
+
+          // The terminal symbols in the order they appear in the rules. The
+          // end of the input is the last one.
+          typedef
+            typename boost::mpl::push_back<
+              typename boost::mpl::fold<
+                Productions,
+                boost::mpl::vector<>,
+                add_terminals
+              >::type,
+              lalr_end
+            >::type
+            terminals;
+        };
+
+        template <class G, class X>
+        struct lalr_is_nonterminal :
+          boost::mpl::has_key<typename G::nonterminals, X>
+        {};
+
+        // An LR(0) item is represented by
+        //   int_<production index * 256 + position of the dot>
+        template <class G, class Item>
+        struct lalr_item_info
+        {
+          typedef boost::mpl::int_<Item::type::value / 256> production_index;
+          typedef boost::mpl::int_<Item::type::value % 256> dot;
+          typedef boost::mpl::int_<Item::type::value + 1> advanced;
+
+          typedef
+            typename boost::mpl::at<
+              typename G::productions,
+              production_index
+            >::type
+            production;
+
+          typedef typename boost::mpl::size<typename production::rhs>::type
+            length;
+
+          typedef boost::mpl::bool_<dot::value == length::value> complete;
+
+          typedef
+            typename boost::mpl::eval_if<
+              complete,
+              boost::mpl::identity<lalr_no_symbol>,
+              boost::mpl::at<typename production::rhs, dot>
+            >::type
+            next_symbol;
+
+          // Lookaheads of the items added by the closure depend only on the
+          // left hand side of their rule, thus they are stored by that
+          typedef
+            typename boost::mpl::eval_if_c<
+              dot::value == 0 && production_index::value != 0,
+              boost::mpl::identity<typename production::lhs>,
+              boost::mpl::identity<typename Item::type>
+            >::type
+            lookahead_key;
+        };
+
+        template <class A, class B>
+        struct lalr_union :
+          boost::mpl::fold<
+            B,
+            A,
+            boost::mpl::insert<boost::mpl::_1, boost::mpl::_2>
+          >
+        {};
+
+        template <class G, class Todo, class Visited>
+        struct lalr_left_corners_impl;
+
+        template <class G, class A>
+        struct lalr_push_left_corner
+        {
+          typedef lalr_push_left_corner type;
+
+          template <class Todo, class P>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::mpl::and_<
+                boost::is_same<typename P::lhs, A>,
+                lalr_is_nonterminal<
+                  G,
+                  typename boost::mpl::front<typename P::rhs>::type
+                >
+              >::type,
+              boost::mpl::push_front<
+                Todo,
+                typename boost::mpl::front<typename P::rhs>::type
+              >,
+              boost::mpl::identity<Todo>
+            >
+          {};
+        };
+
+        template <class G, class Todo, class Visited>
+        struct lalr_left_corners_step
+        {
+          typedef typename boost::mpl::front<Todo>::type symbol;
+          typedef typename boost::mpl::pop_front<Todo>::type rest;
+
+          template <class Dummy = int>
+          struct visit :
+            lalr_left_corners_impl<
+              G,
+              typename boost::mpl::fold<
+                typename G::productions,
+                rest,
+                lalr_push_left_corner<G, symbol>
+              >::type,
+              typename boost::mpl::insert<Visited, symbol>::type
+            >
+          {};
+
+          typedef
+            typename boost::mpl::eval_if<
+              typename boost::mpl::has_key<Visited, symbol>::type,
+              lalr_left_corners_impl<G, rest, Visited>,
+              visit<>
+            >::type
+            type;
+        };
+
+        template <class G, class Todo, class Visited>
+        struct lalr_left_corners_impl :
+          boost::mpl::eval_if<
+            typename boost::mpl::empty<Todo>::type,
+            boost::mpl::identity<Visited>,
+            lalr_left_corners_step<G, Todo, Visited>
+          >
+        {};
+
+        // The set of nonterminals that can appear as the first symbol of
+        // something A is expanded to (including A)
+        template <class G, class A>
+        struct lalr_left_corners :
+          lalr_left_corners_impl<G, boost::mpl::list<A>, boost::mpl::set<> >
+        {};
+
+        template <class G, class Corners>
+        struct lalr_add_first_terminal
+        {
+          typedef lalr_add_first_terminal type;
+
+          template <class Terminals, class P>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::mpl::and_<
+                boost::mpl::has_key<Corners, typename P::lhs>,
+                boost::mpl::not_<
+                  lalr_is_nonterminal<
+                    G,
+                    typename boost::mpl::front<typename P::rhs>::type
+                  >
+                >
+              >::type,
+              boost::mpl::insert<
+                Terminals,
+                typename boost::mpl::front<typename P::rhs>::type
+              >,
+              boost::mpl::identity<Terminals>
+            >
+          {};
+        };
+
+        template <class G, class A>
+        struct lalr_first_of_nonterminal :
+          boost::mpl::fold<
+            typename G::productions,
+            boost::mpl::set<>,
+            lalr_add_first_terminal<
+              G,
+              typename lalr_left_corners<G, A>::type
+            >
+          >
+        {};
+
+        // The set of terminals the things X is expanded to can start with.
+        // The rules have no empty right hand side.
+        template <class G, class X>
+        struct lalr_first :
+          boost::mpl::eval_if<
+            typename lalr_is_nonterminal<G, X>::type,
+            lalr_first_of_nonterminal<G, X>,
+            boost::mpl::set<X>
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,367 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_LALR_LOOKAHEADS_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_LALR_LOOKAHEADS_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/lalr_grammar_info.hpp>
+#include <mpllibs/metaparse/v1/impl/lalr_automaton.hpp>
+
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/range_c.hpp>
+#include <boost/mpl/set.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+/*
+ * The LALR(1) lookaheads are calculated by propagating them along the LR(0)
+ * automaton:
+ *
+ *   - the lookahead of the start item is the end of the input
+ *   - an item A ::= a.Xb of a state inherits the lookaheads of the item
+ *     A ::= aX.b of the states having a transition on X into it
+ *   - the items B ::= .c added by the closure to a state containing the item
+ *     A ::= a.Bb get FIRST(b) when b is not empty and the lookaheads of that
+ *     item otherwise
+ *
+ * The lookaheads of every state are recalculated from the previous values
+ * until they do not change.
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class Lookaheads, class Key>
+        struct lalr_lookahead_at :
+          boost::mpl::eval_if<
+            typename boost::mpl::has_key<Lookaheads, Key>::type,
+            boost::mpl::at<Lookaheads, Key>,
+            boost::mpl::set<>
+          >
+        {};
+
+        template <class G, class A, class I>
+        struct lalr_predecessors
+        {
+          typedef
+            typename boost::mpl::front<
+              typename boost::mpl::at<typename A::states, I>::type
+            >::type
+            item;
+
+          // The symbol before the dot in the kernel items of state I
+          typedef
+            typename boost::mpl::at<
+              typename lalr_item_info<G, item>::production::rhs,
+              boost::mpl::int_<lalr_item_info<G, item>::dot::value - 1>
+            >::type
+            symbol;
+
+          struct add_predecessor
+          {
+            typedef add_predecessor type;
+
+            template <class Predecessors, class J>
+            struct apply
+            {
+              typedef
+                typename boost::mpl::at<typename A::transitions, J>::type
+                t;
+
+              typedef
+                typename boost::mpl::eval_if<
+                  typename boost::mpl::and_<
+                    boost::mpl::has_key<t, symbol>,
+                    boost::is_same<
+                      typename boost::mpl::at<t, symbol>::type,
+                      boost::mpl::int_<I::value>
+                    >
+                  >::type,
+                  boost::mpl::push_back<Predecessors, J>,
+                  boost::mpl::identity<Predecessors>
+                >::type
+                type;
+            };
+          };
+
+          typedef
+            typename boost::mpl::fold<
+              boost::mpl::range_c<
+                int,
+                0,
+                boost::mpl::size<typename A::states>::type::value
+              >,
+              boost::mpl::vector<>,
+              add_predecessor
+            >::type
+            type;
+        };
+
+        template <class G, class LA, class Key>
+        struct lalr_add_lookaheads_of
+        {
+          typedef lalr_add_lookaheads_of type;
+
+          template <class Terminals, class J>
+          struct apply :
+            lalr_union<
+              Terminals,
+              typename lalr_lookahead_at<
+                typename boost::mpl::at<LA, J>::type,
+                Key
+              >::type
+            >
+          {};
+        };
+
+        template <class G, class A, class LA, class I>
+        struct lalr_add_kernel_lookahead
+        {
+          typedef lalr_add_kernel_lookahead type;
+
+          template <class Item>
+          struct propagated :
+            boost::mpl::fold<
+              typename lalr_predecessors<G, A, I>::type,
+              boost::mpl::set<>,
+              lalr_add_lookaheads_of<
+                G,
+                LA,
+                typename lalr_item_info<
+                  G,
+                  boost::mpl::int_<Item::type::value - 1>
+                >::lookahead_key
+              >
+            >
+          {};
+
+          template <class Lookaheads, class Item>
+          struct apply :
+            boost::mpl::insert<
+              Lookaheads,
+              boost::mpl::pair<
+                typename Item::type,
+                typename boost::mpl::eval_if_c<
+                  Item::type::value == 0,
+                  boost::mpl::set<lalr_end>,
+                  propagated<Item>
+                >::type
+              >
+            >
+          {};
+        };
+
+        template <class G, class LA, class I, class B>
+        struct lalr_add_closure_lookahead_from
+        {
+          typedef lalr_add_closure_lookahead_from type;
+
+          template <class Item>
+          struct after_b
+          {
+            typedef lalr_item_info<G, Item> info;
+
+            typedef
+              typename boost::mpl::eval_if_c<
+                info::dot::value + 1 < info::length::value,
+                lalr_first<
+                  G,
+                  typename boost::mpl::at<
+                    typename info::production::rhs,
+                    boost::mpl::int_<info::dot::value + 1>
+                  >::type
+                >,
+                lalr_lookahead_at<
+                  typename boost::mpl::at<LA, I>::type,
+                  typename info::lookahead_key
+                >
+              >::type
+              type;
+          };
+
+          template <class Terminals, class Item>
+          struct add : lalr_union<Terminals, typename after_b<Item>::type> {};
+
+          template <class Terminals, class Item>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::is_same<
+                typename lalr_item_info<G, Item>::next_symbol,
+                B
+              >::type,
+              add<Terminals, Item>,
+              boost::mpl::identity<Terminals>
+            >
+          {};
+        };
+
+        template <class G, class A, class LA, class I>
+        struct lalr_add_closure_lookahead
+        {
+          typedef lalr_add_closure_lookahead type;
+
+          template <class Lookaheads, class B>
+          struct apply :
+            boost::mpl::insert<
+              Lookaheads,
+              boost::mpl::pair<
+                B,
+                typename boost::mpl::fold<
+                  typename lalr_closure<
+                    G,
+                    typename boost::mpl::at<typename A::states, I>::type
+                  >::type,
+                  boost::mpl::set<>,
+                  lalr_add_closure_lookahead_from<G, LA, I, B>
+                >::type
+              >
+            >
+          {};
+        };
+
+        // A map from the lookahead keys of the items to their lookaheads
+        template <class G, class A, class LA, class I>
+        struct lalr_state_lookaheads
+        {
+          typedef typename boost::mpl::at<typename A::states, I>::type kernel;
+
+          typedef
+            typename boost::mpl::fold<
+              typename lalr_closure_nonterminals<G, kernel>::type,
+              typename boost::mpl::fold<
+                kernel,
+                boost::mpl::map<>,
+                lalr_add_kernel_lookahead<G, A, LA, I>
+              >::type,
+              lalr_add_closure_lookahead<G, A, LA, I>
+            >::type
+            type;
+        };
+
+        template <class G, class A, class LA>
+        struct lalr_lookaheads_step
+        {
+          struct add_state
+          {
+            typedef add_state type;
+
+            template <class Result, class I>
+            struct apply :
+              boost::mpl::push_back<
+                Result,
+                typename lalr_state_lookaheads<G, A, LA, I>::type
+              >
+            {};
+          };
+
+          typedef
+            typename boost::mpl::fold<
+              boost::mpl::range_c<
+                int,
+                0,
+                boost::mpl::size<typename A::states>::type::value
+              >,
+              boost::mpl::vector<>,
+              add_state
+            >::type
+            type;
+        };
+
+        struct lalr_add_lookahead_size
+        {
+          typedef lalr_add_lookahead_size type;
+
+          template <class N, class P>
+          struct apply :
+            boost::mpl::int_<
+              N::type::value
+                + boost::mpl::size<typename P::second>::type::value
+            >
+          {};
+        };
+
+        struct lalr_add_state_lookahead_size
+        {
+          typedef lalr_add_state_lookahead_size type;
+
+          template <class N, class Lookaheads>
+          struct apply :
+            boost::mpl::fold<Lookaheads, N, lalr_add_lookahead_size>
+          {};
+        };
+
+        // The lookaheads only grow, thus they have not changed when their
+        // total number has not changed
+        template <class LA>
+        struct lalr_lookaheads_size :
+          boost::mpl::fold<
+            LA,
+            boost::mpl::int_<0>,
+            lalr_add_state_lookahead_size
+          >
+        {};
+
+        template <class G, class A, class LA, class Size>
+        struct lalr_lookaheads_impl
+        {
+          typedef typename lalr_lookaheads_step<G, A, LA>::type next;
+          typedef typename lalr_lookaheads_size<next>::type next_size;
+
+          typedef
+            typename boost::mpl::eval_if_c<
+              next_size::value == Size::value,
+              boost::mpl::identity<next>,
+              lalr_lookaheads_impl<G, A, next, next_size>
+            >::type
+            type;
+        };
+
+        struct lalr_add_empty_lookaheads
+        {
+          typedef lalr_add_empty_lookaheads type;
+
+          template <class LA, class Kernel>
+          struct apply : boost::mpl::push_back<LA, boost::mpl::map<> > {};
+        };
+
+        // A vector containing the lookahead map of each state
+        template <class G, class A>
+        struct lalr_lookaheads :
+          lalr_lookaheads_impl<
+            G,
+            A,
+            typename boost::mpl::fold<
+              typename A::states,
+              boost::mpl::vector<>,
+              lalr_add_empty_lookaheads
+            >::type,
+            boost::mpl::int_<0>
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
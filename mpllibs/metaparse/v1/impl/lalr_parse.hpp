@@ -0,0 +1,434 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_LALR_PARSE_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_LALR_PARSE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/lalr_grammar_info.hpp>
+#include <mpllibs/metaparse/v1/impl/lalr_actions.hpp>
+#include <mpllibs/metaparse/v1/error/none_of_the_expected_cases_found.hpp>
+#include <mpllibs/metaparse/v1/fail.hpp>
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/get_result.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/lit_c.hpp>
+#include <mpllibs/metaparse/v1/return_.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/char.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/list.hpp>
+#include <boost/mpl/pop_front.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct lalr_no_value;
+        struct lalr_no_terminal;
+
+        template <class State, class Value>
+        struct lalr_stack_entry
+        {
+          typedef State state;
+          typedef Value value;
+        };
+
+        // The next terminal of the input. S and Pos are the remaining input
+        // after it.
+        template <class Terminal, class Value, class S, class Pos>
+        struct lalr_token
+        {
+          typedef lalr_token type;
+
+          typedef Terminal terminal;
+          typedef Value value;
+          typedef S remaining;
+          typedef Pos source_position;
+        };
+
+        // Character terminals are parsed by lit_c, the other ones are
+        // imported parsers
+        template <class G, class Terminal>
+        struct lalr_terminal_parser :
+          boost::mpl::at<typename G::imports, Terminal>
+        {};
+
+        template <class G, char C>
+        struct lalr_terminal_parser<G, boost::mpl::char_<C> >
+        {
+          typedef lit_c<C> type;
+        };
+
+        template <class PosA, class PosB>
+        struct lalr_position_less :
+          boost::mpl::bool_<
+            (PosA::type::line::value < PosB::type::line::value)
+            || (
+              PosA::type::line::value == PosB::type::line::value
+              && PosA::type::col::value < PosB::type::col::value
+            )
+          >
+        {};
+
+        // The token consuming more of the input wins, on equal length the
+        // one found first
+        template <class Token, class Best>
+        struct lalr_longer_token :
+          boost::mpl::if_<
+            typename lalr_position_less<
+              typename Best::source_position,
+              typename Token::source_position
+            >::type,
+            Token,
+            Best
+          >
+        {};
+
+        template <class Token, class S, class Pos>
+        struct
+          lalr_longer_token<
+            Token,
+            lalr_token<lalr_no_terminal, lalr_no_value, S, Pos>
+          >
+        {
+          typedef Token type;
+        };
+
+        template <class G, class Terminals, class S, class Pos, class Best>
+        struct lalr_scan_longest;
+
+        template <
+          class G,
+          class Terminal,
+          class Rest,
+          class S,
+          class Pos,
+          class Best
+        >
+        struct lalr_scan_terminal
+        {
+          typedef
+            typename boost::mpl::apply_wrap2<
+              typename lalr_terminal_parser<G, Terminal>::type,
+              S,
+              Pos
+            >::type
+            r;
+
+          template <class Dummy = int>
+          struct accepted :
+            lalr_longer_token<
+              lalr_token<
+                Terminal,
+                typename get_result<r>::type,
+                typename get_remaining<r>::type,
+                typename get_position<r>::type
+              >,
+              Best
+            >
+          {};
+
+          typedef
+            typename lalr_scan_longest<
+              G,
+              Rest,
+              S,
+              Pos,
+              typename boost::mpl::eval_if<
+                typename is_error<r>::type,
+                boost::mpl::identity<Best>,
+                accepted<>
+              >::type
+            >::type
+            type;
+        };
+
+        // The end of the input is the last terminal tried. It is accepted
+        // when no other terminal is and does not consume anything: the
+        // characters left become the remaining part of the input.
+        template <class G, class Rest, class S, class Pos, class Best>
+        struct lalr_scan_terminal<G, lalr_end, Rest, S, Pos, Best> :
+          lalr_scan_longest<G, Rest, S, Pos, Best>
+        {};
+
+        template <class G, class Rest, class S, class Pos>
+        struct
+          lalr_scan_terminal<
+            G,
+            lalr_end,
+            Rest,
+            S,
+            Pos,
+            lalr_token<lalr_no_terminal, lalr_no_value, S, Pos>
+          > :
+          lalr_token<lalr_end, lalr_no_value, S, Pos>
+        {};
+
+        template <class G, class Terminals, class S, class Pos, class Best>
+        struct lalr_scan_longest :
+          boost::mpl::eval_if<
+            typename boost::mpl::empty<Terminals>::type,
+            boost::mpl::identity<Best>,
+            lalr_scan_terminal<
+              G,
+              typename boost::mpl::front<Terminals>::type,
+              typename boost::mpl::pop_front<Terminals>::type,
+              S,
+              Pos,
+              Best
+            >
+          >
+        {};
+
+        // The longest of the expected terminals at the beginning of S.
+        // lalr_no_terminal when none of them is accepted.
+        template <class G, class Terminals, class S, class Pos>
+        struct lalr_scan :
+          lalr_scan_longest<
+            G,
+            Terminals,
+            S,
+            Pos,
+            lalr_token<lalr_no_terminal, lalr_no_value, S, Pos>
+          >
+        {};
+
+        template <int N, class Stack, class Values>
+        struct lalr_pop :
+          lalr_pop<
+            N - 1,
+            typename boost::mpl::pop_front<Stack>::type,
+            typename boost::mpl::push_front<
+              Values,
+              typename boost::mpl::front<Stack>::type::value
+            >::type
+          >
+        {};
+
+        template <class Stack, class Values>
+        struct lalr_pop<0, Stack, Values>
+        {
+          typedef Stack stack;
+          typedef Values values;
+        };
+
+        template <class Action, class Value>
+        struct lalr_semantic_action : boost::mpl::apply_wrap1<Action, Value> {};
+
+        template <class Value>
+        struct lalr_semantic_action<lalr_no_action, Value>
+        {
+          typedef Value type;
+        };
+
+        // The result of a rule with one symbol is the result of that symbol,
+        // the result of a longer rule is the vector of the results of its
+        // symbols
+        template <class Production, class Values>
+        struct lalr_rule_value :
+          lalr_semantic_action<
+            typename Production::action,
+            typename boost::mpl::eval_if_c<
+              boost::mpl::size<Values>::type::value == 1,
+              boost::mpl::front<Values>,
+              boost::mpl::identity<Values>
+            >::type
+          >
+        {};
+
+        template <class T, class Stack, class ProductionIndex>
+        struct lalr_reduce_stack
+        {
+          typedef
+            typename boost::mpl::at<
+              typename T::grammar::productions,
+              ProductionIndex
+            >::type
+            production;
+
+          typedef
+            lalr_pop<
+              boost::mpl::size<typename production::rhs>::type::value,
+              Stack,
+              boost::mpl::vector<>
+            >
+            popped;
+
+          typedef typename popped::stack rest;
+
+          typedef
+            typename boost::mpl::push_front<
+              rest,
+              lalr_stack_entry<
+                typename boost::mpl::at<
+                  typename lalr_state<
+                    T,
+                    typename boost::mpl::front<rest>::type::state
+                  >::transitions,
+                  typename production::lhs
+                >::type,
+                typename lalr_rule_value<
+                  production,
+                  typename popped::values
+                >::type
+              >
+            >::type
+            type;
+        };
+
+        template <class T, class Stack, class Token, class S, class Pos>
+        struct lalr_act;
+
+        template <class T, class Stack, class S, class Pos>
+        struct lalr_step :
+          lalr_act<
+            T,
+            Stack,
+            typename lalr_scan<
+              typename T::grammar,
+              typename lalr_state<
+                T,
+                typename boost::mpl::front<Stack>::type::state
+              >::expected,
+              S,
+              Pos
+            >::type,
+            S,
+            Pos
+          >
+        {};
+
+        // No action: syntax error
+        template <
+          class Action,
+          class T,
+          class Stack,
+          class Token,
+          class S,
+          class Pos
+        >
+        struct lalr_perform :
+          boost::mpl::apply_wrap2<
+            fail<error::none_of_the_expected_cases_found>,
+            S,
+            Pos
+          >
+        {};
+
+        template <
+          class State,
+          class T,
+          class Stack,
+          class Token,
+          class S,
+          class Pos
+        >
+        struct lalr_perform<lalr_shift<State>, T, Stack, Token, S, Pos> :
+          lalr_step<
+            T,
+            typename boost::mpl::push_front<
+              Stack,
+              lalr_stack_entry<State, typename Token::value>
+            >::type,
+            typename Token::remaining,
+            typename Token::source_position
+          >
+        {};
+
+        // The lookahead is kept after a reduction
+        template <
+          class ProductionIndex,
+          class T,
+          class Stack,
+          class Token,
+          class S,
+          class Pos
+        >
+        struct
+          lalr_perform<
+            lalr_reduce<ProductionIndex>,
+            T,
+            Stack,
+            Token,
+            S,
+            Pos
+          > :
+            lalr_act<
+              T,
+              typename lalr_reduce_stack<T, Stack, ProductionIndex>::type,
+              Token,
+              S,
+              Pos
+            >
+        {};
+
+        template <class T, class Stack, class Token, class S, class Pos>
+        struct lalr_perform<lalr_accept, T, Stack, Token, S, Pos> :
+          boost::mpl::apply_wrap2<
+            return_<typename boost::mpl::front<Stack>::type::value>,
+            S,
+            Pos
+          >
+        {};
+
+        template <class T, class Stack, class Token, class S, class Pos>
+        struct lalr_act :
+          lalr_perform<
+            typename boost::mpl::at<
+              typename lalr_state<
+                T,
+                typename boost::mpl::front<Stack>::type::state
+              >::actions,
+              typename Token::terminal
+            >::type,
+            T,
+            Stack,
+            Token,
+            S,
+            Pos
+          >
+        {};
+
+        // Shift-reduce parser using the table T
+        template <class T>
+        struct lalr_parse
+        {
+          typedef lalr_parse type;
+
+          template <class S, class Pos>
+          struct apply :
+            lalr_step<
+              T,
+              boost::mpl::list<
+                lalr_stack_entry<boost::mpl::int_<0>, lalr_no_value>
+              >,
+              S,
+              Pos
+            >
+          {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
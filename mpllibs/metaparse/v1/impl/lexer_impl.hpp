@@ -0,0 +1,198 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_LEXER_IMPL_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_LEXER_IMPL_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/error/unexpected_character.hpp>
+#include <mpllibs/metaparse/v1/fail.hpp>
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/get_result.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/lex_skip.hpp>
+#include <mpllibs/metaparse/v1/lex_token.hpp>
+#include <mpllibs/metaparse/v1/return_.hpp>
+#include <mpllibs/metaparse/v1/source_position.hpp>
+#include <mpllibs/metaparse/v1/impl/further_position.hpp>
+
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/list.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/push_front.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct lex_no_match;
+
+        template <class Rule, class Result>
+        struct lex_match
+        {
+          typedef lex_match type;
+
+          typedef Rule rule;
+          typedef Result result;
+        };
+
+        template <class Best, class Pos>
+        struct lex_match_end : get_position<typename Best::result> {};
+
+        template <class Pos>
+        struct lex_match_end<lex_no_match, Pos>
+        {
+          typedef Pos type;
+        };
+
+        // The rule accepting the longest input. When more than one rule
+        // accepts it, the first one of them is used. Rules accepting the
+        // empty input are ignored.
+        template <class S, class Pos>
+        struct lex_longest_match
+        {
+          typedef lex_longest_match type;
+
+          template <class Best, class Rule>
+          struct apply
+          {
+            typedef
+              typename boost::mpl::apply_wrap2<
+                typename Rule::parser,
+                S,
+                Pos
+              >::type
+              r;
+
+            typedef
+              typename boost::mpl::eval_if<
+                typename boost::mpl::and_<
+                  boost::mpl::not_<typename is_error<r>::type>,
+                  further_position<
+                    typename get_position<r>::type,
+                    typename lex_match_end<Best, Pos>::type
+                  >
+                >::type,
+                lex_match<Rule, r>,
+                boost::mpl::identity<Best>
+              >::type
+              type;
+          };
+        };
+
+        template <class T>
+        struct lex_token_position
+        {
+          typedef typename T::type::source_position type;
+        };
+
+        template <class Tokens, class EndPos>
+        struct lex_next_position :
+          boost::mpl::eval_if<
+            typename boost::mpl::empty<Tokens>::type,
+            boost::mpl::identity<EndPos>,
+            lex_token_position<boost::mpl::front<Tokens> >
+          >
+        {};
+
+        template <class Kind, class Value, class Pos, class Rest>
+        struct lex_add_token
+        {
+          typedef typename get_result<Rest>::type tokens;
+          typedef typename get_position<Rest>::type end;
+
+          typedef
+            typename boost::mpl::apply_wrap2<
+              return_<
+                typename boost::mpl::push_front<
+                  tokens,
+                  lex_token<
+                    Kind,
+                    Value,
+                    Pos,
+                    typename lex_next_position<tokens, end>::type
+                  >
+                >::type
+              >,
+              typename get_remaining<Rest>::type,
+              end
+            >::type
+            type;
+        };
+
+        template <class Value, class Pos, class Rest>
+        struct lex_add_token<lex_skipped, Value, Pos, Rest>
+        {
+          typedef Rest type;
+        };
+
+        template <class Rules, class S, class Pos>
+        struct lexer_impl;
+
+        template <class Rules, class Match, class S, class Pos>
+        struct lexer_step :
+          boost::mpl::apply_wrap2<fail<error::unexpected_character>, S, Pos>
+        {};
+
+        template <class Rules, class Rule, class R, class S, class Pos>
+        struct lexer_step<Rules, lex_match<Rule, R>, S, Pos>
+        {
+          typedef
+            typename lexer_impl<
+              Rules,
+              typename get_remaining<R>::type,
+              typename get_position<R>::type
+            >::type
+            rest;
+
+          typedef
+            typename boost::mpl::eval_if<
+              typename is_error<rest>::type,
+              boost::mpl::identity<rest>,
+              lex_add_token<
+                typename Rule::kind,
+                typename get_result<R>::type,
+                Pos,
+                rest
+              >
+            >::type
+            type;
+        };
+
+        // The result is the list of tokens in the input
+        template <class Rules, class S, class Pos>
+        struct lexer_impl :
+          boost::mpl::eval_if<
+            typename boost::mpl::empty<S>::type,
+            boost::mpl::apply_wrap2<return_<boost::mpl::list<> >, S, Pos>,
+            lexer_step<
+              Rules,
+              typename boost::mpl::fold<
+                Rules,
+                lex_no_match,
+                lex_longest_match<S, Pos>
+              >::type,
+              S,
+              Pos
+            >
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -11,10 +11,10 @@
 #include <mpllibs/metaparse/v1/fail.hpp>
 #include <mpllibs/metaparse/limit_sequence_size.hpp>
 
-#include <boost/mpl/list.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
 
-#include <boost/preprocessor/repetition/repeat.hpp>
-#include <boost/preprocessor/punctuation/comma_if.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 #include <boost/preprocessor/cat.hpp>
 
@@ -26,26 +26,28 @@ namespace mpllibs
     {
       namespace impl
       {
+        template <int K>
+        struct nth_of_c0 : fail<error::index_out_of_range<0, -1, K> > {};
+
         #ifdef MPLLIBS_NTH_OF_CASE
         #  error MPLLIBS_NTH_OF_CASE already defined
         #endif
         #define MPLLIBS_NTH_OF_CASE(z, n, unused) \
-          template < \
-            int K BOOST_PP_COMMA_IF(n) \
-            BOOST_PP_ENUM_PARAMS(n, class P) \
-          > \
+          template <int K, BOOST_PP_ENUM_PARAMS(n, class P)> \
           struct BOOST_PP_CAT(nth_of_c, n) : \
             boost::mpl::if_< \
               boost::mpl::bool_<(0 <= K && K < n)>, \
-              nth_of_c_impl< \
-                K, \
-                boost::mpl::list<BOOST_PP_ENUM_PARAMS(n, P)> \
-              >, \
+              BOOST_PP_CAT(nth_of_c_impl, n)<K, BOOST_PP_ENUM_PARAMS(n, P)>, \
               fail<error::index_out_of_range<0, n - 1, K> > \
             >::type \
           {};
         
-        BOOST_PP_REPEAT(MPLLIBS_LIMIT_SEQUENCE_SIZE, MPLLIBS_NTH_OF_CASE, ~)
+        BOOST_PP_REPEAT_FROM_TO(
+          1,
+          MPLLIBS_LIMIT_SEQUENCE_SIZE,
+          MPLLIBS_NTH_OF_CASE,
+          ~
+        )
         
         #undef MPLLIBS_NTH_OF_CASE
       }
@@ -7,12 +7,21 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metaparse/v1/impl/skip_seq.hpp>
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/limit_sequence_size.hpp>
 
 #include <boost/mpl/apply.hpp>
-#include <boost/mpl/apply_wrap.hpp>
-#include <boost/mpl/front.hpp>
-#include <boost/mpl/pop_front.hpp>
-#include <boost/mpl/fold.hpp>
+#include <boost/mpl/eval_if.hpp>
+
+#include <boost/preprocessor/arithmetic/dec.hpp>
+#include <boost/preprocessor/arithmetic/sub.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
+#include <boost/preprocessor/tuple/eat.hpp>
 
 namespace mpllibs
 {
@@ -22,56 +31,79 @@ namespace mpllibs
     {
       namespace impl
       {
-        template <int N, class Seq>
-        struct nth_of_c_impl
-        {
-        private:
-          template <class NextResult>
-          struct apply_unchecked :
-            boost::mpl::apply_wrap2<
-              nth_of_c_impl<
-                N - 1,
-                typename boost::mpl::pop_front<Seq>::type
-              >,
-              typename get_remaining<NextResult>::type,
-              typename get_position<NextResult>::type
-            >
-          {};
-        public:
-          typedef nth_of_c_impl type;
-          
-          template <class S, class Pos>
-          struct apply :
-            boost::mpl::eval_if<
-              typename is_error<
-                boost::mpl::apply<typename boost::mpl::front<Seq>::type, S, Pos>
-              >::type,
-              boost::mpl::apply<typename boost::mpl::front<Seq>::type, S, Pos>,
-              apply_unchecked<
-                boost::mpl::apply<typename boost::mpl::front<Seq>::type, S, Pos>
-              >
-            >
-          {};
-        };
-        
-        template <class Seq>
-        struct nth_of_c_impl<0, Seq>
-        {
-          typedef nth_of_c_impl type;
-          
-          template <class S, class Pos>
-          struct apply :
-            boost::mpl::fold<
-              typename boost::mpl::pop_front<Seq>::type,
-              typename boost::mpl::apply<
-                typename boost::mpl::front<Seq>::type,
-                S,
-                Pos
-              >::type,
-              skip_seq
-            >
-          {};
-        };
+        template <class P, class R>
+        struct nth_of_c_apply_after :
+          boost::mpl::apply<
+            P,
+            typename get_remaining<R>::type,
+            typename get_position<R>::type
+          >
+        {};
+
+        // Applies P to the input left by R. The result of parsing is the
+        // result of R when KeepResult is true and the result of P otherwise.
+        template <bool KeepResult, class P, class R>
+        struct nth_of_c_step;
+
+        template <class P, class R>
+        struct nth_of_c_step<true, P, R> : skip_seq::apply<R, P> {};
+
+        template <class P, class R>
+        struct nth_of_c_step<false, P, R> :
+          boost::mpl::eval_if<
+            typename is_error<R>::type,
+            R,
+            nth_of_c_apply_after<P, R>
+          >
+        {};
+
+        // The parsers are applied one after the other without building a
+        // sequence of them. The parsers after the K-th one keep its result.
+        #ifdef MPLLIBS_NTH_OF_C_STEP_PREFIX
+        #  error MPLLIBS_NTH_OF_C_STEP_PREFIX already defined
+        #endif
+        #define MPLLIBS_NTH_OF_C_STEP_PREFIX(z, i, n) \
+          typename nth_of_c_step< \
+            (BOOST_PP_SUB(BOOST_PP_DEC(n), i) > K), \
+            BOOST_PP_CAT(P, BOOST_PP_SUB(BOOST_PP_DEC(n), i)), \
+
+        #ifdef MPLLIBS_NTH_OF_C_IMPL
+        #  error MPLLIBS_NTH_OF_C_IMPL already defined
+        #endif
+        #define MPLLIBS_NTH_OF_C_IMPL(z, n, unused) \
+          template <int K, BOOST_PP_ENUM_PARAMS(n, class P)> \
+          struct BOOST_PP_CAT(nth_of_c_impl, n) \
+          { \
+            typedef BOOST_PP_CAT(nth_of_c_impl, n) type; \
+            \
+            template <class S, class Pos> \
+            struct apply \
+            { \
+              typedef \
+                BOOST_PP_REPEAT( \
+                  BOOST_PP_DEC(n), \
+                  MPLLIBS_NTH_OF_C_STEP_PREFIX, \
+                  n \
+                ) \
+                  typename boost::mpl::apply<P0, S, Pos>::type \
+                BOOST_PP_REPEAT( \
+                  BOOST_PP_DEC(n), \
+                  >::type BOOST_PP_TUPLE_EAT(3), \
+                  ~ \
+                ) \
+                type; \
+            }; \
+          };
+
+        BOOST_PP_REPEAT_FROM_TO(
+          1,
+          MPLLIBS_LIMIT_SEQUENCE_SIZE,
+          MPLLIBS_NTH_OF_C_IMPL,
+          ~
+        )
+
+        #undef MPLLIBS_NTH_OF_C_IMPL
+        #undef MPLLIBS_NTH_OF_C_STEP_PREFIX
       }
     }
   }
@@ -7,15 +7,16 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metaparse/limit_one_of_size.hpp>
-#include <mpllibs/metaparse/v1/error/none_of_the_expected_cases_found.hpp>
 #include <mpllibs/metaparse/v1/is_error.hpp>
-#include <mpllibs/metaparse/v1/fail.hpp>
+#include <mpllibs/metaparse/v1/impl/one_of_failure.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
 
 #include <boost/mpl/if.hpp>
 #include <boost/mpl/not.hpp>
 #include <boost/mpl/apply.hpp>
 #include <boost/mpl/apply_wrap.hpp>
 
+#include <boost/preprocessor/arithmetic/dec.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/repetition/repeat_from_to.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
@@ -42,6 +43,21 @@ namespace mpllibs
             >, \
             BOOST_PP_CAT(P, n), \
         
+        // When all of the parsers reject the input, the errors are merged
+        #ifdef MPLLIBS_ONE_OF_FAILURE_PREFIX
+        #  error MPLLIBS_ONE_OF_FAILURE_PREFIX already defined
+        #endif
+        #define MPLLIBS_ONE_OF_FAILURE_PREFIX(z, n, unused) \
+          one_of_failure<BOOST_PP_CAT(P, n),
+
+        #ifdef MPLLIBS_ONE_OF_FAILURE
+        #  error MPLLIBS_ONE_OF_FAILURE already defined
+        #endif
+        #define MPLLIBS_ONE_OF_FAILURE(n) \
+          BOOST_PP_REPEAT(BOOST_PP_DEC(n), MPLLIBS_ONE_OF_FAILURE_PREFIX, ~) \
+            BOOST_PP_CAT(P, BOOST_PP_DEC(n)) \
+          BOOST_PP_REPEAT(BOOST_PP_DEC(n), > BOOST_PP_TUPLE_EAT(3), ~)
+        
         #ifdef MPLLIBS_MPLLIBS_ONE_OF
         #  error MPLLIBS_MPLLIBS_ONE_OF already defined
         #endif
@@ -55,12 +71,14 @@ namespace mpllibs
             struct apply : \
               boost::mpl::apply_wrap2< \
                 BOOST_PP_REPEAT(n, MPLLIBS_ONE_OF_BODY_PREFIX, ~) \
-                  fail<error::none_of_the_expected_cases_found> \
+                  MPLLIBS_ONE_OF_FAILURE(n) \
                 BOOST_PP_REPEAT(n, >::type BOOST_PP_TUPLE_EAT(3), ~), \
                 S, \
                 Pos \
               > \
-            {}; \
+            { \
+              MPLLIBS_METAPARSE_TRACE_APPLY(BOOST_PP_CAT(one_of_, n), S, Pos) \
+            }; \
           };
         
         BOOST_PP_REPEAT_FROM_TO(
@@ -71,6 +89,8 @@ namespace mpllibs
         )
         
         #undef MPLLIBS_MPLLIBS_ONE_OF
+        #undef MPLLIBS_ONE_OF_FAILURE
+        #undef MPLLIBS_ONE_OF_FAILURE_PREFIX
         #undef MPLLIBS_ONE_OF_BODY_PREFIX
       }
     }
@@ -0,0 +1,132 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_ONE_OF_FAILURE_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_ONE_OF_FAILURE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/error/expected_one_of.hpp>
+#include <mpllibs/metaparse/v1/fail.hpp>
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/impl/further_position.hpp>
+
+#include <boost/mpl/apply.hpp>
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/contains.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/vector.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The expected items a message is about
+        template <class Msg>
+        struct expected_messages
+        {
+          typedef boost::mpl::vector<Msg> type;
+        };
+
+        template <class Messages>
+        struct expected_messages<error::expected_one_of<Messages> >
+        {
+          typedef Messages type;
+        };
+
+        struct add_expected_message
+        {
+          typedef add_expected_message type;
+
+          template <class Messages, class Msg>
+          struct apply :
+            boost::mpl::eval_if<
+              typename boost::mpl::contains<Messages, Msg>::type,
+              boost::mpl::identity<Messages>,
+              boost::mpl::push_back<Messages, Msg>
+            >
+          {};
+        };
+
+        template <class MsgA, class MsgB>
+        struct merge_messages
+        {
+          typedef
+            error::expected_one_of<
+              typename boost::mpl::fold<
+                typename expected_messages<MsgB>::type,
+                typename expected_messages<MsgA>::type,
+                add_expected_message
+              >::type
+            >
+            type;
+        };
+
+        // The messages are merged without evaluating them, since messages
+        // are not required to be metafunctions
+        template <class S, class A, class B>
+        struct merge_errors_at_same_position :
+          boost::mpl::apply_wrap2<
+            fail<
+              typename merge_messages<
+                typename A::type::message,
+                typename B::type::message
+              >::type
+            >,
+            S,
+            typename get_position<A>::type
+          >
+        {};
+
+        // The error reported by a parser failing when A and B fail. It is
+        // the one reaching further in the input. When they fail at the same
+        // position, the expected items of both of them are reported.
+        template <class S, class A, class B>
+        struct merge_errors :
+          boost::mpl::eval_if<
+            typename further_position<
+              typename get_position<B>::type,
+              typename get_position<A>::type
+            >::type,
+            B,
+            boost::mpl::eval_if<
+              typename further_position<
+                typename get_position<A>::type,
+                typename get_position<B>::type
+              >::type,
+              A,
+              merge_errors_at_same_position<S, A, B>
+            >
+          >
+        {};
+
+        // A parser returning the merged error of P1 and P2. It is used when
+        // both of them reject the input.
+        template <class P1, class P2>
+        struct one_of_failure
+        {
+          typedef one_of_failure type;
+
+          template <class S, class Pos>
+          struct apply :
+            merge_errors<
+              S,
+              typename boost::mpl::apply<P1, S, Pos>::type,
+              typename boost::mpl::apply<P2, S, Pos>::type
+            >
+          {};
+        };
+      }
+    }
+  }
+}
+
+#endif
+
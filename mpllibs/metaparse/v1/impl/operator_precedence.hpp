@@ -0,0 +1,284 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_OPERATOR_PRECEDENCE_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_OPERATOR_PRECEDENCE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/get_result.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/return_.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/next.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+/*
+ * Precedence climbing
+ *
+ * expression(min) ::= operand (infix with power >= min, expression(rhs))*
+ * operand ::= prefix expression(operand power) | atom
+ *
+ * The rhs of an infix operator is parsed with min set to the power of the
+ * operator for right associative and to one more for left associative ones.
+ * The operator parsers are applied only once at each position, every
+ * precedence level is handled by the same loop.
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct operator_not_found;
+
+        template <class Op, class Result>
+        struct operator_found
+        {
+          typedef operator_found type;
+
+          typedef Op op;
+          typedef Result result;
+        };
+
+        template <class Begin, class End, bool Prefix, class S, class Pos>
+        struct find_operator;
+
+        template <class Begin, class End, bool Prefix, class S, class Pos>
+        struct find_operator_at
+        {
+          typedef typename boost::mpl::deref<Begin>::type op;
+
+          template <class Dummy = int>
+          struct try_next :
+            find_operator<
+              typename boost::mpl::next<Begin>::type,
+              End,
+              Prefix,
+              S,
+              Pos
+            >
+          {};
+
+          template <class Dummy = int>
+          struct try_op
+          {
+            typedef
+              typename boost::mpl::apply_wrap2<typename op::parser, S, Pos>::type
+              r;
+
+            typedef
+              typename boost::mpl::eval_if<
+                typename is_error<r>::type,
+                try_next<>,
+                operator_found<op, r>
+              >::type
+              type;
+          };
+
+          typedef
+            typename boost::mpl::eval_if_c<
+              op::prefix::type::value == Prefix,
+              try_op<>,
+              try_next<>
+            >::type
+            type;
+        };
+
+        // The first operator of the table accepting the input
+        template <class Begin, class End, bool Prefix, class S, class Pos>
+        struct find_operator :
+          boost::mpl::eval_if<
+            typename boost::is_same<Begin, End>::type,
+            boost::mpl::identity<operator_not_found>,
+            find_operator_at<Begin, End, Prefix, S, Pos>
+          >
+        {};
+
+        template <class T, class MinPower, class S, class Pos>
+        struct operator_expression;
+
+        template <class T, class Found, class S, class Pos>
+        struct operator_operand :
+          boost::mpl::apply_wrap2<typename T::atom, S, Pos>
+        {};
+
+        template <class T, class Op, class R, class S, class Pos>
+        struct operator_operand<T, operator_found<Op, R>, S, Pos>
+        {
+          typedef
+            typename operator_expression<
+              T,
+              typename Op::operand_power,
+              typename get_remaining<R>::type,
+              typename get_position<R>::type
+            >::type
+            operand;
+
+          template <class Dummy = int>
+          struct apply_op :
+            boost::mpl::apply_wrap2<
+              return_<
+                typename boost::mpl::apply_wrap1<
+                  typename Op::action,
+                  typename get_result<operand>::type
+                >::type
+              >,
+              typename get_remaining<operand>::type,
+              typename get_position<operand>::type
+            >
+          {};
+
+          typedef
+            typename boost::mpl::eval_if<
+              typename is_error<operand>::type,
+              boost::mpl::identity<operand>,
+              apply_op<>
+            >::type
+            type;
+        };
+
+        template <class T, class MinPower, class Lhs, class S, class Pos>
+        struct operator_loop;
+
+        // Lhs is accepted before the operator when it can not be used
+        template <
+          class T,
+          class MinPower,
+          class Lhs,
+          class Found,
+          class S,
+          class Pos
+        >
+        struct operator_loop_at :
+          boost::mpl::apply_wrap2<return_<Lhs>, S, Pos>
+        {};
+
+        template <
+          class T,
+          class MinPower,
+          class Lhs,
+          class Op,
+          class R,
+          class S,
+          class Pos
+        >
+        struct operator_loop_at<T, MinPower, Lhs, operator_found<Op, R>, S, Pos>
+        {
+          template <class Dummy = int>
+          struct apply_op
+          {
+            typedef
+              typename operator_expression<
+                T,
+                typename Op::operand_power,
+                typename get_remaining<R>::type,
+                typename get_position<R>::type
+              >::type
+              rhs;
+
+            template <class Dummy2 = int>
+            struct next :
+              operator_loop<
+                T,
+                MinPower,
+                typename boost::mpl::apply_wrap2<
+                  typename Op::action,
+                  Lhs,
+                  typename get_result<rhs>::type
+                >::type,
+                typename get_remaining<rhs>::type,
+                typename get_position<rhs>::type
+              >
+            {};
+
+            typedef
+              typename boost::mpl::eval_if<
+                typename is_error<rhs>::type,
+                boost::mpl::apply_wrap2<return_<Lhs>, S, Pos>,
+                next<>
+              >::type
+              type;
+          };
+
+          typedef
+            typename boost::mpl::eval_if_c<
+              (Op::power::type::value < MinPower::type::value),
+              boost::mpl::apply_wrap2<return_<Lhs>, S, Pos>,
+              apply_op<>
+            >::type
+            type;
+        };
+
+        template <class T, class MinPower, class Lhs, class S, class Pos>
+        struct operator_loop :
+          operator_loop_at<
+            T,
+            MinPower,
+            Lhs,
+            typename find_operator<
+              typename T::begin,
+              typename T::end,
+              false,
+              S,
+              Pos
+            >::type,
+            S,
+            Pos
+          >
+        {};
+
+        template <class T, class MinPower, class Operand>
+        struct operator_loop_after :
+          operator_loop<
+            T,
+            MinPower,
+            typename get_result<Operand>::type,
+            typename get_remaining<Operand>::type,
+            typename get_position<Operand>::type
+          >
+        {};
+
+        template <class T, class MinPower, class S, class Pos>
+        struct operator_expression
+        {
+          typedef
+            typename operator_operand<
+              T,
+              typename find_operator<
+                typename T::begin,
+                typename T::end,
+                true,
+                S,
+                Pos
+              >::type,
+              S,
+              Pos
+            >::type
+            operand;
+
+          typedef
+            typename boost::mpl::eval_if<
+              typename is_error<operand>::type,
+              boost::mpl::identity<operand>,
+              operator_loop_after<T, MinPower, operand>
+            >::type
+            type;
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,283 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_REGEX_AUTOMATON_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_REGEX_AUTOMATON_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/char_class.hpp>
+#include <mpllibs/metaparse/v1/util/in_char_class.hpp>
+#include <mpllibs/metaparse/v1/impl/regex_syntax.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/char.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/integral_c.hpp>
+#include <boost/mpl/list.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <boost/static_assert.hpp>
+
+/*
+ * Position automaton
+ *
+ * Every character class of the regular expression is a position. The bit I
+ * of a state is set when the automaton is after the character of position
+ * I. Position 0 is the beginning of the input, the start state is 1. The
+ * positions that can follow each other are calculated from the syntax tree,
+ * the next state after a character is the set of positions following the
+ * current ones and accepting the character. The set of states reachable from
+ * the start state is the deterministic automaton of the regular expression,
+ * the states are the subsets of the positions represented by bitmasks.
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <int I, class Class>
+        struct regex_position
+        {
+          typedef regex_position type;
+
+          typedef Class char_class;
+          static const unsigned long mask = 1ul << I;
+        };
+
+        // The positions in To can follow the positions in From
+        template <unsigned long From, unsigned long To>
+        struct regex_follow
+        {
+          typedef regex_follow type;
+
+          static const unsigned long from = From;
+          static const unsigned long to = To;
+        };
+
+        // Positions is the vector of the positions found so far and Follows
+        // is the list of the regex_follow elements found so far
+        template <class Node, class Positions, class Follows>
+        struct regex_build;
+
+        template <class Positions, class Follows>
+        struct regex_build<regex_empty, Positions, Follows>
+        {
+          typedef Positions positions;
+          typedef Follows follows;
+
+          static const bool nullable = true;
+          static const unsigned long first = 0;
+          static const unsigned long last = 0;
+        };
+
+        template <class Class, class Positions, class Follows>
+        struct regex_build<regex_chars<Class>, Positions, Follows>
+        {
+          BOOST_STATIC_ASSERT(boost::mpl::size<Positions>::type::value < 32);
+
+          typedef
+            regex_position<boost::mpl::size<Positions>::type::value, Class>
+            position;
+
+          typedef
+            typename boost::mpl::push_back<Positions, position>::type
+            positions;
+          typedef Follows follows;
+
+          static const bool nullable = false;
+          static const unsigned long first = position::mask;
+          static const unsigned long last = position::mask;
+        };
+
+        template <class A, class B, class Positions, class Follows>
+        struct regex_build<regex_seq<A, B>, Positions, Follows>
+        {
+          typedef regex_build<A, Positions, Follows> a;
+          typedef
+            regex_build<B, typename a::positions, typename a::follows>
+            b;
+
+          typedef typename b::positions positions;
+          typedef
+            typename boost::mpl::push_front<
+              typename b::follows,
+              regex_follow<a::last, b::first>
+            >::type
+            follows;
+
+          static const bool nullable = a::nullable && b::nullable;
+          static const unsigned long first =
+            a::first | (a::nullable ? b::first : 0ul);
+          static const unsigned long last =
+            b::last | (b::nullable ? a::last : 0ul);
+        };
+
+        template <class A, class B, class Positions, class Follows>
+        struct regex_build<regex_alt<A, B>, Positions, Follows>
+        {
+          typedef regex_build<A, Positions, Follows> a;
+          typedef
+            regex_build<B, typename a::positions, typename a::follows>
+            b;
+
+          typedef typename b::positions positions;
+          typedef typename b::follows follows;
+
+          static const bool nullable = a::nullable || b::nullable;
+          static const unsigned long first = a::first | b::first;
+          static const unsigned long last = a::last | b::last;
+        };
+
+        template <class A, class Positions, class Follows, bool Nullable>
+        struct regex_build_repeat
+        {
+          typedef regex_build<A, Positions, Follows> a;
+
+          typedef typename a::positions positions;
+          typedef
+            typename boost::mpl::push_front<
+              typename a::follows,
+              regex_follow<a::last, a::first>
+            >::type
+            follows;
+
+          static const bool nullable = Nullable || a::nullable;
+          static const unsigned long first = a::first;
+          static const unsigned long last = a::last;
+        };
+
+        template <class A, class Positions, class Follows>
+        struct regex_build<regex_star<A>, Positions, Follows> :
+          regex_build_repeat<A, Positions, Follows, true>
+        {};
+
+        template <class A, class Positions, class Follows>
+        struct regex_build<regex_plus<A>, Positions, Follows> :
+          regex_build_repeat<A, Positions, Follows, false>
+        {};
+
+        template <class A, class Positions, class Follows>
+        struct regex_build<regex_opt<A>, Positions, Follows>
+        {
+          typedef regex_build<A, Positions, Follows> a;
+
+          typedef typename a::positions positions;
+          typedef typename a::follows follows;
+
+          static const bool nullable = true;
+          static const unsigned long first = a::first;
+          static const unsigned long last = a::last;
+        };
+
+        // The automaton of the regular expression R
+        template <class R>
+        struct regex_automaton
+        {
+          typedef regex_automaton type;
+
+          typedef
+            regex_build<
+              typename boost::mpl::apply_wrap1<regex_syntax, R>::type,
+              boost::mpl::vector<regex_position<0, char_class<> > >,
+              boost::mpl::list<>
+            >
+            root;
+
+          typedef typename root::positions positions;
+          typedef
+            typename boost::mpl::push_front<
+              typename root::follows,
+              regex_follow<1, root::first>
+            >::type
+            follows;
+
+          static const unsigned long start = 1;
+          static const unsigned long final =
+            root::last | (root::nullable ? 1ul : 0ul);
+        };
+
+        template <unsigned long State>
+        struct regex_add_follow
+        {
+          typedef regex_add_follow type;
+
+          template <class Mask, class Follow>
+          struct apply :
+            boost::mpl::integral_c<
+              unsigned long,
+              Mask::type::value
+                | ((Follow::from & State) != 0 ? Follow::to : 0ul)
+            >
+          {};
+        };
+
+        // The positions that can follow the ones in State
+        template <class A, unsigned long State>
+        struct regex_follow_of :
+          boost::mpl::fold<
+            typename A::follows,
+            boost::mpl::integral_c<unsigned long, 0>,
+            regex_add_follow<State>
+          >::type
+        {};
+
+        template <int Code>
+        struct regex_add_position
+        {
+          typedef regex_add_position type;
+
+          template <class Mask, class Position>
+          struct apply :
+            boost::mpl::integral_c<
+              unsigned long,
+              Mask::type::value
+                | (
+                  util::in_char_class<typename Position::char_class>
+                    ::template apply<boost::mpl::char_<char(Code)> >::value ?
+                    Position::mask :
+                    0ul
+                )
+            >
+          {};
+        };
+
+        // The positions accepting the character with code Code
+        template <class A, int Code>
+        struct regex_char_positions :
+          boost::mpl::fold<
+            typename A::positions,
+            boost::mpl::integral_c<unsigned long, 0>,
+            regex_add_position<Code>
+          >::type
+        {};
+
+        // The state after the character with code Code in state State
+        template <class A, unsigned long State, int Code>
+        struct regex_next :
+          boost::mpl::integral_c<
+            unsigned long,
+            regex_follow_of<A, State>::value
+              & regex_char_positions<A, Code>::value
+          >
+        {};
+
+        template <class A, unsigned long State>
+        struct regex_accepting :
+          boost::mpl::bool_<(State & A::final) != 0>
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,151 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_REGEX_IMPL_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_REGEX_IMPL_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/regex_automaton.hpp>
+#include <mpllibs/metaparse/v1/error/unexpected_character.hpp>
+#include <mpllibs/metaparse/v1/error/unexpected_end_of_input.hpp>
+#include <mpllibs/metaparse/v1/fail.hpp>
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_remaining.hpp>
+#include <mpllibs/metaparse/v1/one_char.hpp>
+#include <mpllibs/metaparse/v1/return_.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/push_back.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct regex_no_match;
+
+        template <class S, class Pos, class Best>
+        struct regex_finish
+        {
+          typedef Best type;
+        };
+
+        template <class S, class Pos>
+        struct regex_finish<S, Pos, regex_no_match> :
+          boost::mpl::apply_wrap2<
+            typename boost::mpl::if_<
+              typename boost::mpl::empty<S>::type,
+              fail<error::unexpected_end_of_input>,
+              fail<error::unexpected_character>
+            >::type,
+            S,
+            Pos
+          >
+        {};
+
+        // Best is the result of the longest match found so far
+        template <
+          class A,
+          unsigned long State,
+          class S,
+          class Pos,
+          class Matched,
+          class Best = regex_no_match
+        >
+        struct regex_longest_match;
+
+        template <
+          class A,
+          unsigned long Next,
+          class S,
+          class Pos,
+          class Matched,
+          class Best
+        >
+        struct regex_longest_match_step :
+          regex_longest_match<
+            A,
+            Next,
+            typename get_remaining<
+              boost::mpl::apply_wrap2<one_char, S, Pos>
+            >::type,
+            typename get_position<
+              boost::mpl::apply_wrap2<one_char, S, Pos>
+            >::type,
+            typename boost::mpl::push_back<
+              Matched,
+              typename boost::mpl::front<S>::type
+            >::type,
+            Best
+          >
+        {};
+
+        // No position follows the current ones: the automaton is stuck
+        template <class A, class S, class Pos, class Matched, class Best>
+        struct regex_longest_match_step<A, 0, S, Pos, Matched, Best> :
+          regex_finish<S, Pos, Best>
+        {};
+
+        template <class A, unsigned long State, class S, class Pos>
+        struct regex_next_in :
+          regex_next<
+            A,
+            State,
+            static_cast<unsigned char>(boost::mpl::front<S>::type::value)
+          >
+        {};
+
+        template <
+          class A,
+          unsigned long State,
+          class S,
+          class Pos,
+          class Matched,
+          class Best
+        >
+        struct regex_longest_match
+        {
+          typedef
+            typename boost::mpl::eval_if<
+              regex_accepting<A, State>,
+              boost::mpl::apply_wrap2<return_<Matched>, S, Pos>,
+              boost::mpl::identity<Best>
+            >::type
+            best;
+
+          template <class Dummy = int>
+          struct step :
+            regex_longest_match_step<
+              A,
+              regex_next_in<A, State, S, Pos>::type::value,
+              S,
+              Pos,
+              Matched,
+              best
+            >
+          {};
+
+          typedef
+            typename boost::mpl::eval_if<
+              typename boost::mpl::empty<S>::type,
+              regex_finish<S, Pos, best>,
+              step<>
+            >::type
+            type;
+        };
+      }
+    }
+  }
+}
+
+#endif
+
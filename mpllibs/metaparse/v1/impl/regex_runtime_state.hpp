@@ -0,0 +1,62 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_REGEX_RUNTIME_STATE_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_REGEX_RUNTIME_STATE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/regex_automaton.hpp>
+
+#include <boost/preprocessor/repetition/enum.hpp>
+
+/*
+ * The states of the automaton reachable from the start state are emitted as
+ * constant tables. Each state has the address of the next state for every
+ * character, the addresses are constant expressions, thus the tables are
+ * statically initialised. The table of a state is instantiated only when
+ * another table refers to it. State 0 is the dead state, every character
+ * leads back to it.
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct regex_runtime_state
+        {
+          bool accepting;
+          const regex_runtime_state* next[256];
+        };
+
+        template <class A, unsigned long State>
+        struct regex_runtime_table
+        {
+          static const regex_runtime_state value;
+        };
+
+        #ifdef MPLLIBS_REGEX_RUNTIME_NEXT
+        #  error MPLLIBS_REGEX_RUNTIME_NEXT already defined
+        #endif
+        #define MPLLIBS_REGEX_RUNTIME_NEXT(z, n, unused) \
+          &regex_runtime_table<A, regex_next<A, State, n>::value>::value
+
+        template <class A, unsigned long State>
+        const regex_runtime_state regex_runtime_table<A, State>::value =
+          {
+            regex_accepting<A, State>::type::value,
+            { BOOST_PP_ENUM(256, MPLLIBS_REGEX_RUNTIME_NEXT, ~) }
+          };
+
+        #undef MPLLIBS_REGEX_RUNTIME_NEXT
+      }
+    }
+  }
+}
+
+#endif
+
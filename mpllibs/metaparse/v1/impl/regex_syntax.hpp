@@ -0,0 +1,288 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_REGEX_SYNTAX_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_REGEX_SYNTAX_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/always_c.hpp>
+#include <mpllibs/metaparse/v1/build_parser.hpp>
+#include <mpllibs/metaparse/v1/char_class.hpp>
+#include <mpllibs/metaparse/v1/char_class_c.hpp>
+#include <mpllibs/metaparse/v1/char_class_not.hpp>
+#include <mpllibs/metaparse/v1/char_class_range_c.hpp>
+#include <mpllibs/metaparse/v1/char_class_union.hpp>
+#include <mpllibs/metaparse/v1/entire_input.hpp>
+#include <mpllibs/metaparse/v1/foldl.hpp>
+#include <mpllibs/metaparse/v1/foldl1.hpp>
+#include <mpllibs/metaparse/v1/foldlp.hpp>
+#include <mpllibs/metaparse/v1/last_of.hpp>
+#include <mpllibs/metaparse/v1/lit_c.hpp>
+#include <mpllibs/metaparse/v1/middle_of.hpp>
+#include <mpllibs/metaparse/v1/one_char.hpp>
+#include <mpllibs/metaparse/v1/one_of.hpp>
+#include <mpllibs/metaparse/v1/return_.hpp>
+#include <mpllibs/metaparse/v1/sequence.hpp>
+#include <mpllibs/metaparse/v1/transform.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/at.hpp>
+
+/*
+ * The grammar of the regular expressions
+ *
+ * alternatives ::= sequence ('|' sequence)*
+ * sequence ::= repeated*
+ * repeated ::= atom ('*' | '+' | '?')*
+ * atom ::= '(' alternatives ')' | '.' | bracket | escape | char_lit
+ * bracket ::= '[' '^'? bracket_item+ ']'
+ * bracket_item ::= bracket_char '-' bracket_char | escape | bracket_char
+ * escape ::= '\' any character
+ * char_lit ::= any character except . ( ) | * + ? [ ] \
+ * bracket_char ::= any character except ] \
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The syntax tree of a regular expression
+        struct regex_empty
+        {
+          typedef regex_empty type;
+        };
+
+        template <class Class>
+        struct regex_chars
+        {
+          typedef regex_chars type;
+        };
+
+        template <class A, class B>
+        struct regex_seq
+        {
+          typedef regex_seq type;
+        };
+
+        template <class A, class B>
+        struct regex_alt
+        {
+          typedef regex_alt type;
+        };
+
+        template <class A>
+        struct regex_star
+        {
+          typedef regex_star type;
+        };
+
+        template <class A>
+        struct regex_plus
+        {
+          typedef regex_plus type;
+        };
+
+        template <class A>
+        struct regex_opt
+        {
+          typedef regex_opt type;
+        };
+
+        // Metafunction classes building the syntax tree. The folding
+        // operations take the new element first and the state second.
+        struct regex_char_class
+        {
+          typedef regex_char_class type;
+
+          template <class C>
+          struct apply : char_class_c<C::type::value> {};
+        };
+
+        struct regex_make_range
+        {
+          typedef regex_make_range type;
+
+          template <class Seq>
+          struct apply :
+            char_class_range_c<
+              boost::mpl::at_c<Seq, 0>::type::type::value,
+              boost::mpl::at_c<Seq, 2>::type::type::value
+            >
+          {};
+        };
+
+        struct regex_make_union
+        {
+          typedef regex_make_union type;
+
+          template <class A, class B>
+          struct apply : char_class_union<A, B> {};
+        };
+
+        struct regex_make_not
+        {
+          typedef regex_make_not type;
+
+          template <class A>
+          struct apply : char_class_not<A> {};
+        };
+
+        struct regex_make_chars
+        {
+          typedef regex_make_chars type;
+
+          template <class Class>
+          struct apply : regex_chars<Class> {};
+        };
+
+        template <template <class> class Node>
+        struct regex_make_postfix
+        {
+          typedef regex_make_postfix type;
+
+          template <class A>
+          struct apply : Node<A> {};
+        };
+
+        struct regex_apply_postfix
+        {
+          typedef regex_apply_postfix type;
+
+          template <class Op, class A>
+          struct apply : boost::mpl::apply_wrap1<Op, A> {};
+        };
+
+        struct regex_make_seq
+        {
+          typedef regex_make_seq type;
+
+          template <class B, class A>
+          struct apply : regex_seq<A, B> {};
+        };
+
+        struct regex_make_alt
+        {
+          typedef regex_make_alt type;
+
+          template <class B, class A>
+          struct apply : regex_alt<A, B> {};
+        };
+
+        // The parser of the regular expressions
+        struct regex_alternatives;
+
+        typedef
+          char_class_c<'.', '(', ')', '|', '*', '+', '?', '[', ']', '\\'>
+          regex_special;
+
+        typedef
+          last_of<
+            lit_c<'\\'>,
+            one_of<
+              always_c<'d', char_class_range_c<'0', '9'> >,
+              always_c<'s', char_class_c<' ', '\t', '\n', '\r', '\f', '\v'> >,
+              always_c<
+                'w',
+                char_class_union<
+                  char_class_union<
+                    char_class_range_c<'a', 'z'>,
+                    char_class_range_c<'A', 'Z'>
+                  >,
+                  char_class_union<
+                    char_class_range_c<'0', '9'>,
+                    char_class_c<'_'>
+                  >
+                >
+              >,
+              transform<one_char, regex_char_class>
+            >
+          >
+          regex_escape;
+
+        typedef char_class_not<char_class_c<']', '\\'> > regex_bracket_char;
+
+        typedef
+          one_of<
+            transform<
+              sequence<regex_bracket_char, lit_c<'-'>, regex_bracket_char>,
+              regex_make_range
+            >,
+            regex_escape,
+            transform<regex_bracket_char, regex_char_class>
+          >
+          regex_bracket_item;
+
+        typedef
+          foldl1<regex_bracket_item, char_class<>, regex_make_union>
+          regex_bracket_items;
+
+        typedef
+          middle_of<
+            lit_c<'['>,
+            one_of<
+              last_of<
+                lit_c<'^'>,
+                transform<regex_bracket_items, regex_make_not>
+              >,
+              regex_bracket_items
+            >,
+            lit_c<']'>
+          >
+          regex_bracket;
+
+        typedef
+          one_of<
+            middle_of<lit_c<'('>, regex_alternatives, lit_c<')'> >,
+            transform<
+              one_of<
+                always_c<'.', char_class_not<char_class_c<'\n'> > >,
+                regex_bracket,
+                regex_escape,
+                transform<char_class_not<regex_special>, regex_char_class>
+              >,
+              regex_make_chars
+            >
+          >
+          regex_atom;
+
+        typedef
+          foldlp<
+            one_of<
+              always_c<'*', regex_make_postfix<regex_star> >,
+              always_c<'+', regex_make_postfix<regex_plus> >,
+              always_c<'?', regex_make_postfix<regex_opt> >
+            >,
+            regex_atom,
+            regex_apply_postfix
+          >
+          regex_repeated;
+
+        typedef
+          foldlp<regex_repeated, regex_repeated, regex_make_seq>
+          regex_nonempty_sequence;
+
+        typedef
+          one_of<regex_nonempty_sequence, return_<regex_empty> >
+          regex_sequence;
+
+        struct regex_alternatives :
+          foldlp<
+            last_of<lit_c<'|'>, regex_sequence>,
+            regex_sequence,
+            regex_make_alt
+          >
+        {};
+
+        typedef build_parser<entire_input<regex_alternatives> > regex_syntax;
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,78 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_REVERSE_LIST_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_REVERSE_LIST_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/list.hpp>
+#include <boost/mpl/pop_front.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/size.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // Moves the first N elements of From to the front of To in reverse
+        // order. The depth of the template instantiations is logarithmic in
+        // N.
+        template <int N, class From, class To>
+        struct reverse_list_chunk
+        {
+          typedef reverse_list_chunk<N / 2, From, To> first_half;
+          typedef
+            reverse_list_chunk<
+              N - N / 2,
+              typename first_half::from,
+              typename first_half::to
+            >
+            second_half;
+
+          typedef typename second_half::from from;
+          typedef typename second_half::to to;
+        };
+
+        template <class From, class To>
+        struct reverse_list_chunk<0, From, To>
+        {
+          typedef From from;
+          typedef To to;
+        };
+
+        template <class From, class To>
+        struct reverse_list_chunk<1, From, To>
+        {
+          typedef typename boost::mpl::pop_front<From>::type from;
+          typedef
+            typename boost::mpl::push_front<
+              To,
+              typename boost::mpl::front<From>::type
+            >::type
+            to;
+        };
+
+        template <class L>
+        struct reverse_list
+        {
+          typedef
+            typename reverse_list_chunk<
+              boost::mpl::size<L>::type::value,
+              L,
+              boost::mpl::list<>
+            >::to
+            type;
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -7,6 +7,7 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metaparse/v1/impl/sequence_impl.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
 #include <mpllibs/metaparse/limit_sequence_size.hpp>
 
 #include <boost/mpl/vector.hpp>
@@ -39,7 +40,9 @@ namespace mpllibs
                 S, \
                 Pos \
               > \
-            {}; \
+            { \
+              MPLLIBS_METAPARSE_TRACE_APPLY(BOOST_PP_CAT(sequence, n), S, Pos) \
+            }; \
           };
         
         BOOST_PP_REPEAT_FROM_TO(
@@ -0,0 +1,161 @@
+#ifndef MPLLIBS_METAPARSE_V1_IMPL_TRACE_HPP
+#define MPLLIBS_METAPARSE_V1_IMPL_TRACE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * When MPLLIBS_METAPARSE_TRACE is defined, the combinators record every
+ * parser application the compiler instantiates. The records are collected
+ * at program startup and can be displayed by print_trace.
+ */
+
+#ifdef MPLLIBS_METAPARSE_TRACE
+
+#include <mpllibs/metaparse/v1/is_error.hpp>
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_line.hpp>
+#include <mpllibs/metaparse/v1/get_col.hpp>
+#include <mpllibs/metaparse/v1/impl/debug_segment.hpp>
+
+#include <vector>
+#include <typeinfo>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct trace_entry
+        {
+          const std::type_info* parser;
+          const std::type_info* input;
+          int start_line;
+          int start_col;
+          int end_line;
+          int end_col;
+          bool success;
+          // "line 1, col 1 - line 1, col 2: accepted "
+          const debug_segment (*text)[9];
+        };
+
+        inline std::vector<trace_entry>& trace_log()
+        {
+          static std::vector<trace_entry> log;
+          return log;
+        }
+
+        template <bool Success, class Dummy = int>
+        struct trace_outcome
+        {
+          static const char value[];
+        };
+
+        template <bool Success, class Dummy>
+        const char trace_outcome<Success, Dummy>::value[] = ": accepted ";
+
+        template <class Dummy>
+        struct trace_outcome<false, Dummy>
+        {
+          static const char value[];
+        };
+
+        template <class Dummy>
+        const char trace_outcome<false, Dummy>::value[] = ": rejected ";
+
+        template <class P, class S, class Pos, class Result>
+        struct trace_record
+        {
+          static bool add()
+          {
+            typedef typename get_position<Result>::type end;
+
+            const trace_entry e =
+              {
+                &typeid(P),
+                &typeid(S),
+                get_line<Pos>::type::value,
+                get_col<Pos>::type::value,
+                get_line<end>::type::value,
+                get_col<end>::type::value,
+                !is_error<Result>::type::value,
+                &text
+              };
+            trace_log().push_back(e);
+            return true;
+          }
+
+          static const debug_segment text[9];
+          static bool recorded;
+        };
+
+        template <class P, class S, class Pos, class Result>
+        const debug_segment trace_record<P, S, Pos, Result>::text[9] =
+          {
+            MPLLIBS_METAPARSE_DEBUG_TEXT("line "),
+            MPLLIBS_METAPARSE_DEBUG_DECIMAL(get_line<Pos>::type::value),
+            MPLLIBS_METAPARSE_DEBUG_TEXT(", col "),
+            MPLLIBS_METAPARSE_DEBUG_DECIMAL(get_col<Pos>::type::value),
+            MPLLIBS_METAPARSE_DEBUG_TEXT(" - line "),
+            MPLLIBS_METAPARSE_DEBUG_DECIMAL(
+              get_line<typename get_position<Result>::type>::type::value
+            ),
+            MPLLIBS_METAPARSE_DEBUG_TEXT(", col "),
+            MPLLIBS_METAPARSE_DEBUG_DECIMAL(
+              get_col<typename get_position<Result>::type>::type::value
+            ),
+            {trace_outcome<!is_error<Result>::type::value>::value, 11}
+          };
+
+        template <class P, class S, class Pos, class Result>
+        bool trace_record<P, S, Pos, Result>::recorded =
+          trace_record<P, S, Pos, Result>::add();
+
+        // Referring to the address of trace_record<...>::recorded is what
+        // makes the compiler instantiate (and the program run) add
+        template <bool*>
+        struct trace_force {};
+      }
+    }
+  }
+}
+
+#ifdef MPLLIBS_METAPARSE_TRACE_RESULT
+#  error MPLLIBS_METAPARSE_TRACE_RESULT already defined
+#endif
+#define MPLLIBS_METAPARSE_TRACE_RESULT(parser, s, pos, result) \
+  typedef \
+    ::mpllibs::metaparse::v1::impl::trace_force< \
+      &::mpllibs::metaparse::v1::impl::trace_record< \
+        parser, \
+        s, \
+        pos, \
+        result \
+      >::recorded \
+    > \
+    mpllibs_metaparse_trace;
+
+#else
+
+#ifdef MPLLIBS_METAPARSE_TRACE_RESULT
+#  error MPLLIBS_METAPARSE_TRACE_RESULT already defined
+#endif
+#define MPLLIBS_METAPARSE_TRACE_RESULT(parser, s, pos, result)
+
+#endif
+
+// Used in the body of the apply template of a parser, after its base class
+// has calculated the result
+#ifdef MPLLIBS_METAPARSE_TRACE_APPLY
+#  error MPLLIBS_METAPARSE_TRACE_APPLY already defined
+#endif
+#define MPLLIBS_METAPARSE_TRACE_APPLY(parser, s, pos) \
+  MPLLIBS_METAPARSE_TRACE_RESULT(parser, s, pos, typename apply::type)
+
+#endif
+
@@ -0,0 +1,36 @@
+#ifndef MPLLIBS_METAPARSE_V1_INFIX_LEFT_OP_HPP
+#define MPLLIBS_METAPARSE_V1_INFIX_LEFT_OP_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/int.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      // The right operand of a left associative operator binds tighter than it
+      template <class P, class Power, class F>
+      struct infix_left_op
+      {
+        typedef infix_left_op type;
+
+        typedef P parser;
+        typedef Power power;
+        typedef F action;
+
+        typedef boost::mpl::false_ prefix;
+        typedef boost::mpl::int_<Power::type::value + 1> operand_power;
+      };
+    }
+  }
+}
+
+#endif
+
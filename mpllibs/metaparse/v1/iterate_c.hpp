@@ -8,7 +8,7 @@
 
 #include <mpllibs/metaparse/v1/impl/iterate_impl.hpp>
 
-#include <boost/mpl/deque.hpp>
+#include <boost/mpl/list.hpp>
 
 namespace mpllibs
 {
@@ -17,7 +17,7 @@ namespace mpllibs
     namespace v1
     {
       template <class P, int N>
-      struct iterate_c : impl::iterate_impl<N, P, boost::mpl::deque<> > {};
+      struct iterate_c : impl::iterate_impl<N, P, boost::mpl::list<> > {};
     }
   }
 }
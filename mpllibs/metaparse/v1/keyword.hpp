@@ -7,6 +7,7 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metaparse/v1/impl/accepted_keyword.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
 #include <mpllibs/metaparse/v1/lit.hpp>
 #include <mpllibs/metaparse/v1/return_.hpp>
 #include <mpllibs/metaparse/v1/is_error.hpp>
@@ -78,7 +79,9 @@ namespace mpllibs
             S,
             Pos
           >
-        {};
+        {
+          MPLLIBS_METAPARSE_TRACE_APPLY(keyword, S, Pos)
+        };
       };
     }
   }
@@ -0,0 +1,279 @@
+#ifndef MPLLIBS_METAPARSE_V1_LALR_GRAMMAR_HPP
+#define MPLLIBS_METAPARSE_V1_LALR_GRAMMAR_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/grammar.hpp>
+#include <mpllibs/metaparse/v1/any.hpp>
+#include <mpllibs/metaparse/v1/any1.hpp>
+#include <mpllibs/metaparse/v1/build_parser.hpp>
+#include <mpllibs/metaparse/v1/entire_input.hpp>
+#include <mpllibs/metaparse/v1/last_of.hpp>
+#include <mpllibs/metaparse/v1/one_of.hpp>
+#include <mpllibs/metaparse/v1/sequence.hpp>
+#include <mpllibs/metaparse/v1/string.hpp>
+#include <mpllibs/metaparse/v1/impl/lalr_grammar_info.hpp>
+#include <mpllibs/metaparse/v1/impl/lalr_actions.hpp>
+#include <mpllibs/metaparse/v1/impl/lalr_parse.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/back.hpp>
+#include <boost/mpl/back_inserter.hpp>
+#include <boost/mpl/copy.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/lambda.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/vector.hpp>
+
+/*
+ * The grammar of the rules
+ *
+ * rule_definition ::= name_token define_token alternatives
+ * alternatives ::= alternative (or_token alternative)*
+ * alternative ::= symbol+
+ * symbol ::= char_token | name_token
+ */
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace lalr_grammar_util
+      {
+        typedef
+          one_of<grammar_util::char_token, grammar_util::name_token>
+          symbol_token;
+
+        typedef any1<symbol_token> alternative;
+
+        typedef
+          sequence<
+            alternative,
+            any<last_of<grammar_util::or_token, alternative> >
+          >
+          alternatives;
+
+        typedef
+          build_parser<
+            entire_input<
+              sequence<
+                grammar_util::name_token,
+                grammar_util::define_token,
+                alternatives
+              >
+            >
+          >
+          rule_parser;
+
+        typedef build_parser<entire_input<any1<symbol_token> > >
+          symbols_parser;
+
+        template <class Name, class Action>
+        struct add_production
+        {
+          typedef add_production type;
+
+          // The table construction accesses the symbols of the right hand
+          // side by index
+          template <class Productions, class Rhs>
+          struct apply :
+            boost::mpl::push_back<
+              Productions,
+              impl::lalr_production<
+                Name,
+                typename boost::mpl::copy<
+                  Rhs,
+                  boost::mpl::back_inserter<boost::mpl::vector<> >
+                >::type,
+                Action
+              >
+            >
+          {};
+        };
+
+        template <class Action>
+        struct rule_action : boost::mpl::lambda<Action> {};
+
+        template <>
+        struct rule_action<impl::lalr_no_action>
+        {
+          typedef impl::lalr_no_action type;
+        };
+
+        // One production is added for each alternative of the rule
+        template <class Productions, class Def, class Action>
+        struct add_rule
+        {
+          typedef typename boost::mpl::apply_wrap1<rule_parser, Def>::type p;
+          typedef typename boost::mpl::at_c<p, 2>::type alts;
+
+          typedef
+            typename boost::mpl::fold<
+              typename boost::mpl::push_front<
+                typename boost::mpl::back<alts>::type,
+                typename boost::mpl::front<alts>::type
+              >::type,
+              Productions,
+              add_production<
+                typename boost::mpl::front<p>::type,
+                typename rule_action<Action>::type
+              >
+            >::type
+            type;
+        };
+
+        template <class Precedence>
+        struct add_precedence
+        {
+          typedef add_precedence type;
+
+          template <class Map, class Terminal>
+          struct apply :
+            boost::mpl::insert<Map, boost::mpl::pair<Terminal, Precedence> >
+          {};
+        };
+
+        // Every declaration has a higher precedence than the previous ones
+        template <class Map, class Level, class Assoc, class Terminals>
+        struct add_precedences :
+          boost::mpl::fold<
+            typename boost::mpl::apply_wrap1<symbols_parser, Terminals>::type,
+            Map,
+            add_precedence<impl::lalr_precedence<Level, Assoc> >
+          >
+        {};
+
+        template <
+          class Start,
+          class Productions,
+          class Imports,
+          class Precedence,
+          class Level
+        >
+        struct lalr_grammar_builder
+        {
+          typedef lalr_grammar_builder type;
+
+          typedef
+            impl::lalr_table<
+              impl::lalr_grammar_info<Productions, Imports, Precedence>
+            >
+            table;
+
+          // Make it a parser
+          template <class S, class Pos>
+          struct apply :
+            boost::mpl::apply_wrap2<impl::lalr_parse<table>, S, Pos>
+          {};
+
+          template <class Name, class P>
+          struct import :
+            lalr_grammar_builder<
+              Start,
+              Productions,
+              typename boost::mpl::insert<
+                Imports,
+                boost::mpl::pair<typename grammar_util::rebuild<Name>::type, P>
+              >::type,
+              Precedence,
+              Level
+            >
+          {};
+
+          template <class Def, class Action = impl::lalr_no_action>
+          struct rule :
+            lalr_grammar_builder<
+              Start,
+              typename add_rule<Productions, Def, Action>::type,
+              Imports,
+              Precedence,
+              Level
+            >
+          {};
+
+          template <class Terminals>
+          struct left :
+            lalr_grammar_builder<
+              Start,
+              Productions,
+              Imports,
+              typename add_precedences<
+                Precedence,
+                boost::mpl::int_<Level::type::value + 1>,
+                impl::lalr_left,
+                Terminals
+              >::type,
+              boost::mpl::int_<Level::type::value + 1>
+            >
+          {};
+
+          template <class Terminals>
+          struct right :
+            lalr_grammar_builder<
+              Start,
+              Productions,
+              Imports,
+              typename add_precedences<
+                Precedence,
+                boost::mpl::int_<Level::type::value + 1>,
+                impl::lalr_right,
+                Terminals
+              >::type,
+              boost::mpl::int_<Level::type::value + 1>
+            >
+          {};
+
+          template <class Terminals>
+          struct nonassoc :
+            lalr_grammar_builder<
+              Start,
+              Productions,
+              Imports,
+              typename add_precedences<
+                Precedence,
+                boost::mpl::int_<Level::type::value + 1>,
+                impl::lalr_nonassoc,
+                Terminals
+              >::type,
+              boost::mpl::int_<Level::type::value + 1>
+            >
+          {};
+        };
+      }
+
+      template <class Start = string<'S'> >
+      struct lalr_grammar :
+        lalr_grammar_util::lalr_grammar_builder<
+          Start,
+          boost::mpl::vector<
+            impl::lalr_production<
+              impl::lalr_start,
+              boost::mpl::vector<
+                typename grammar_util::rebuild<Start>::type
+              >,
+              impl::lalr_no_action
+            >
+          >,
+          boost::mpl::map<>,
+          boost::mpl::map<>,
+          boost::mpl::int_<0>
+        >
+      {};
+    }
+  }
+}
+
+#endif
+
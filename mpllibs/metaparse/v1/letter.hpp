@@ -10,7 +10,9 @@
 #include <mpllibs/metaparse/v1/accept_when.hpp>
 #include <mpllibs/metaparse/v1/one_char.hpp>
 
-#include <mpllibs/metaparse/v1/util/is_letter.hpp>
+#include <mpllibs/metaparse/v1/char_class_range_c.hpp>
+#include <mpllibs/metaparse/v1/char_class_union.hpp>
+#include <mpllibs/metaparse/v1/util/in_char_class.hpp>
 
 namespace mpllibs
 {
@@ -19,7 +21,16 @@ namespace mpllibs
     namespace v1
     {
       typedef
-        accept_when<one_char, util::is_letter<>, error::letter_expected>
+        accept_when<
+          one_char,
+          util::in_char_class<
+            char_class_union<
+              char_class_range_c<'a', 'z'>,
+              char_class_range_c<'A', 'Z'>
+            >
+          >,
+          error::letter_expected
+        >
         letter;
     }
   }
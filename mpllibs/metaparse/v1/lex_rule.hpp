@@ -0,0 +1,28 @@
+#ifndef MPLLIBS_METAPARSE_V1_LEX_RULE_HPP
+#define MPLLIBS_METAPARSE_V1_LEX_RULE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      template <class Kind, class P>
+      struct lex_rule
+      {
+        typedef lex_rule type;
+
+        typedef Kind kind;
+        typedef P parser;
+      };
+    }
+  }
+}
+
+#endif
+
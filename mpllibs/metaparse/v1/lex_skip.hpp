@@ -0,0 +1,30 @@
+#ifndef MPLLIBS_METAPARSE_V1_LEX_SKIP_HPP
+#define MPLLIBS_METAPARSE_V1_LEX_SKIP_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/lex_rule.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct lex_skipped;
+      }
+
+      // The text accepted by P is not turned into a token
+      template <class P>
+      struct lex_skip : lex_rule<impl::lex_skipped, P> {};
+    }
+  }
+}
+
+#endif
+
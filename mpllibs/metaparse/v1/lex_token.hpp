@@ -0,0 +1,31 @@
+#ifndef MPLLIBS_METAPARSE_V1_LEX_TOKEN_HPP
+#define MPLLIBS_METAPARSE_V1_LEX_TOKEN_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      // NextPos is the position of the next token or the end of the input
+      template <class Kind, class Value, class Pos, class NextPos>
+      struct lex_token
+      {
+        typedef lex_token type;
+
+        typedef Kind kind;
+        typedef Value value;
+        typedef Pos source_position;
+        typedef NextPos next_position;
+      };
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,56 @@
+#ifndef MPLLIBS_METAPARSE_V1_LEXED_HPP
+#define MPLLIBS_METAPARSE_V1_LEXED_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/lexer_impl.hpp>
+#include <mpllibs/metaparse/v1/get_position.hpp>
+#include <mpllibs/metaparse/v1/get_result.hpp>
+#include <mpllibs/metaparse/v1/is_error.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/eval_if.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      // P is applied to the tokens L turns the input into
+      template <class L, class P>
+      class lexed
+      {
+      private:
+        template <class Res>
+        struct apply_unchecked :
+          boost::mpl::apply_wrap2<
+            P,
+            typename get_result<Res>::type,
+            typename impl::lex_next_position<
+              typename get_result<Res>::type,
+              typename get_position<Res>::type
+            >::type
+          >
+        {};
+      public:
+        typedef lexed type;
+
+        template <class S, class Pos>
+        struct apply :
+          boost::mpl::eval_if<
+            typename is_error<boost::mpl::apply_wrap2<L, S, Pos> >::type,
+            boost::mpl::apply_wrap2<L, S, Pos>,
+            apply_unchecked<boost::mpl::apply_wrap2<L, S, Pos> >
+          >
+        {};
+      };
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,34 @@
+#ifndef MPLLIBS_METAPARSE_V1_LEXER_HPP
+#define MPLLIBS_METAPARSE_V1_LEXER_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/lexer_impl.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      template <class Rules>
+      struct lexer
+      {
+        typedef lexer type;
+
+        template <class S, class Pos>
+        struct apply : impl::lexer_impl<Rules, S, Pos>
+        {
+          MPLLIBS_METAPARSE_TRACE_APPLY(lexer, S, Pos)
+        };
+      };
+    }
+  }
+}
+
+#endif
+
@@ -12,7 +12,6 @@
 
 #include <boost/mpl/equal_to.hpp>
 #include <boost/mpl/lambda.hpp>
-#include <boost/mpl/push_back.hpp>
 
 namespace mpllibs
 {
@@ -6,7 +6,7 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <mpllibs/metaparse/v1/nth_of.hpp>
+#include <mpllibs/metaparse/v1/impl/nth_of_c.hpp>
 
 namespace mpllibs
 {
@@ -15,7 +15,7 @@ namespace mpllibs
     namespace v1
     {
       template <class P1, class P2, class P3>
-      struct middle_of : nth_of_c<1, P1, P2, P3> {};
+      struct middle_of : impl::nth_of_c3<1, P1, P2, P3> {};
     }
   }
 }
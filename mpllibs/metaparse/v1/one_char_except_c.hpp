@@ -7,23 +7,17 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <mpllibs/metaparse/limit_one_char_except_size.hpp>
-#include <mpllibs/metaparse/v1/error/unexpected_character.hpp>
-#include <mpllibs/metaparse/v1/impl/is_any.hpp>
-#include <mpllibs/metaparse/v1/accept_when.hpp>
-#include <mpllibs/metaparse/v1/one_char.hpp>
+#include <mpllibs/metaparse/limit_char_class_size.hpp>
+#include <mpllibs/metaparse/v1/char_class_c.hpp>
+#include <mpllibs/metaparse/v1/char_class_not.hpp>
 
-#include <boost/mpl/char.hpp>
-
-#include <boost/preprocessor/cat.hpp>
-#include <boost/preprocessor/arithmetic/sub.hpp>
-#include <boost/preprocessor/arithmetic/mul.hpp>
-#include <boost/preprocessor/arithmetic/dec.hpp>
-#include <boost/preprocessor/repetition/repeat.hpp>
-#include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 #include <boost/preprocessor/repetition/enum_params_with_a_default.hpp>
-#include <boost/preprocessor/punctuation/comma_if.hpp>
-#include <boost/preprocessor/tuple/eat.hpp>
+
+#if MPLLIBS_LIMIT_ONE_CHAR_EXCEPT_SIZE > MPLLIBS_LIMIT_CHAR_CLASS_SIZE
+#  error MPLLIBS_LIMIT_ONE_CHAR_EXCEPT_SIZE is greater than \
+  MPLLIBS_LIMIT_CHAR_CLASS_SIZE
+#endif
 
 namespace mpllibs
 {
@@ -31,6 +25,8 @@ namespace mpllibs
   {
     namespace v1
     {
+      // The unused arguments are 1024, which is not a character and is
+      // ignored by char_class_c
       template <
         BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(
           MPLLIBS_LIMIT_ONE_CHAR_EXCEPT_SIZE,
@@ -38,50 +34,13 @@ namespace mpllibs
           1024
         )
       >
-      struct one_char_except_c;
-
-      #ifdef MPLLIBS_METAPARSE_WRAP
-      #  error MPLLIBS_METAPARSE_WRAP already defined
-      #endif
-      #define MPLLIBS_METAPARSE_WRAP(z, n, unused) \
-        boost::mpl::char_<BOOST_PP_CAT(C, n)>
-
-      #ifdef MPLLBIS_METAPARSE_ONE_CHAR_EXCEPT_CASE
-      #  error MPLLBIS_METAPARSE_ONE_CHAR_EXCEPT_CASE already defined
-      #endif
-      #define MPLLBIS_METAPARSE_ONE_CHAR_EXCEPT_CASE(z, n, unused) \
-        template <BOOST_PP_ENUM_PARAMS(n, int C)> \
-        struct one_char_except_c< \
-          BOOST_PP_ENUM_PARAMS(n, C) \
-          BOOST_PP_COMMA_IF( \
-            BOOST_PP_MUL( \
-              n, \
-              BOOST_PP_SUB(BOOST_PP_DEC(MPLLIBS_LIMIT_ONE_CHAR_EXCEPT_SIZE), n)\
-            ) \
-          ) \
-          BOOST_PP_ENUM( \
-            BOOST_PP_SUB(BOOST_PP_DEC(MPLLIBS_LIMIT_ONE_CHAR_EXCEPT_SIZE), n), \
-            1024 BOOST_PP_TUPLE_EAT(3), \
-            ~ \
-          ) \
-        > : \
-          accept_when< \
-            one_char, \
-            impl::BOOST_PP_CAT(is_any, n)< \
-              BOOST_PP_ENUM(n, MPLLIBS_METAPARSE_WRAP, ~) \
-            >, \
-            error::unexpected_character \
-          > \
-        {};
-
-      BOOST_PP_REPEAT(
-        MPLLIBS_LIMIT_ONE_CHAR_EXCEPT_SIZE,
-        MPLLBIS_METAPARSE_ONE_CHAR_EXCEPT_CASE,
-        ~
-      )
-
-      #undef MPLLBIS_METAPARSE_ONE_CHAR_EXCEPT_CASE
-      #undef MPLLIBS_METAPARSE_WRAP
+      struct one_char_except_c :
+        char_class_not<
+          char_class_c<
+            BOOST_PP_ENUM_PARAMS(MPLLIBS_LIMIT_ONE_CHAR_EXCEPT_SIZE, C)
+          >
+        >
+      {};
     }
   }
 }
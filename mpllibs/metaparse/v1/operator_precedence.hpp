@@ -0,0 +1,47 @@
+#ifndef MPLLIBS_METAPARSE_V1_OPERATOR_PRECEDENCE_HPP
+#define MPLLIBS_METAPARSE_V1_OPERATOR_PRECEDENCE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/operator_precedence.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
+
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/int.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      template <class Atom, class Ops>
+      struct operator_precedence
+      {
+        typedef operator_precedence type;
+
+        typedef Atom atom;
+        typedef typename boost::mpl::begin<Ops>::type begin;
+        typedef typename boost::mpl::end<Ops>::type end;
+
+        template <class S, class Pos>
+        struct apply :
+          impl::operator_expression<
+            operator_precedence,
+            boost::mpl::int_<0>,
+            S,
+            Pos
+          >
+        {
+          MPLLIBS_METAPARSE_TRACE_APPLY(operator_precedence, S, Pos)
+        };
+      };
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,35 @@
+#ifndef MPLLIBS_METAPARSE_V1_PREFIX_OP_HPP
+#define MPLLIBS_METAPARSE_V1_PREFIX_OP_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/bool.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      // The operand may contain operators binding at least as tight as it
+      template <class P, class Power, class F>
+      struct prefix_op
+      {
+        typedef prefix_op type;
+
+        typedef P parser;
+        typedef Power power;
+        typedef F action;
+
+        typedef boost::mpl::true_ prefix;
+        typedef Power operand_power;
+      };
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,118 @@
+#ifndef MPLLIBS_METAPARSE_V1_PRINT_TRACE_HPP
+#define MPLLIBS_METAPARSE_V1_PRINT_TRACE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
+
+#include <boost/core/demangle.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        struct trace_histogram_row
+        {
+          std::string parser;
+          int attempts;
+          int accepted;
+
+          trace_histogram_row(const std::string& parser_) :
+            parser(parser_),
+            attempts(0),
+            accepted(0)
+          {}
+
+          bool operator<(const trace_histogram_row& r_) const
+          {
+            return
+              attempts > r_.attempts
+              || (attempts == r_.attempts && parser < r_.parser);
+          }
+        };
+      }
+
+      // Displays how many times the parsers were applied during compilation.
+      // The rows are ordered by the number of applications.
+      inline void print_trace(std::ostream& o_ = std::cout)
+      {
+        using std::setw;
+        using std::endl;
+
+        o_ << "Parser applications" << endl;
+        o_ << "-------------------" << endl;
+#ifdef MPLLIBS_METAPARSE_TRACE
+        std::map<std::string, impl::trace_histogram_row> rows;
+        const std::vector<impl::trace_entry>& log = impl::trace_log();
+        for (
+          std::vector<impl::trace_entry>::const_iterator i = log.begin(),
+            e = log.end();
+          i != e;
+          ++i
+        )
+        {
+          const std::string name = boost::core::demangle(i->parser->name());
+          std::map<std::string, impl::trace_histogram_row>::iterator r =
+            rows.insert(std::make_pair(name, impl::trace_histogram_row(name)))
+              .first;
+          ++r->second.attempts;
+          if (i->success)
+          {
+            ++r->second.accepted;
+          }
+        }
+
+        std::vector<impl::trace_histogram_row> sorted;
+        for (
+          std::map<std::string, impl::trace_histogram_row>::const_iterator
+            i = rows.begin(),
+            e = rows.end();
+          i != e;
+          ++i
+        )
+        {
+          sorted.push_back(i->second);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        o_
+          << setw(10) << "attempts" << setw(10) << "accepted"
+          << setw(10) << "rejected" << "  parser" << endl;
+        for (
+          std::vector<impl::trace_histogram_row>::const_iterator
+            i = sorted.begin(),
+            e = sorted.end();
+          i != e;
+          ++i
+        )
+        {
+          o_
+            << setw(10) << i->attempts
+            << setw(10) << i->accepted
+            << setw(10) << (i->attempts - i->accepted)
+            << "  " << i->parser << endl;
+        }
+#else
+        o_ << "Tracing is disabled, define MPLLIBS_METAPARSE_TRACE" << endl;
+#endif
+      }
+    }
+  }
+}
+
+#endif
+
@@ -6,10 +6,7 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <mpllibs/metaparse/v1/accept_when.hpp>
-#include <mpllibs/metaparse/v1/one_char.hpp>
-#include <mpllibs/metaparse/v1/util/in_range_c.hpp>
-#include <mpllibs/metaparse/v1/error/unexpected_character.hpp>
+#include <mpllibs/metaparse/v1/char_class_range_c.hpp>
 
 namespace mpllibs
 {
@@ -18,13 +15,7 @@ namespace mpllibs
     namespace v1
     {
       template <char From, char To>
-      struct range_c :
-        accept_when<
-          one_char,
-          util::in_range_c<char, From, To>,
-          error::unexpected_character
-        >
-      {};
+      struct range_c : char_class_range_c<From, To> {};
     }
   }
 }
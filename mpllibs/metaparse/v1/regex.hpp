@@ -0,0 +1,45 @@
+#ifndef MPLLIBS_METAPARSE_V1_REGEX_HPP
+#define MPLLIBS_METAPARSE_V1_REGEX_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/regex_automaton.hpp>
+#include <mpllibs/metaparse/v1/impl/regex_impl.hpp>
+#include <mpllibs/metaparse/v1/impl/trace.hpp>
+#include <mpllibs/metaparse/v1/string.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      template <class R>
+      struct regex
+      {
+        typedef regex type;
+
+        typedef impl::regex_automaton<R> automaton;
+
+        template <class S, class Pos>
+        struct apply :
+          impl::regex_longest_match<
+            automaton,
+            automaton::start,
+            S,
+            Pos,
+            string<>
+          >
+        {
+          MPLLIBS_METAPARSE_TRACE_APPLY(regex, S, Pos)
+        };
+      };
+    }
+  }
+}
+
+#endif
+
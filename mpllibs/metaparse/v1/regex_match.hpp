@@ -0,0 +1,59 @@
+#ifndef MPLLIBS_METAPARSE_V1_REGEX_MATCH_HPP
+#define MPLLIBS_METAPARSE_V1_REGEX_MATCH_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/regex_automaton.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/integral_c.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        template <class A>
+        struct regex_match_step
+        {
+          typedef regex_match_step type;
+
+          template <class State, class C>
+          struct apply :
+            regex_next<
+              A,
+              State::type::value,
+              static_cast<unsigned char>(C::type::value)
+            >
+          {};
+        };
+      }
+
+      // The whole string S matches the regular expression R
+      template <class R, class S>
+      struct regex_match :
+        impl::regex_accepting<
+          impl::regex_automaton<R>,
+          boost::mpl::fold<
+            S,
+            boost::mpl::integral_c<
+              unsigned long,
+              impl::regex_automaton<R>::start
+            >,
+            impl::regex_match_step<impl::regex_automaton<R> >
+          >::type::value
+        >
+      {};
+    }
+  }
+}
+
+#endif
+
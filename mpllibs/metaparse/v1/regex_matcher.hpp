@@ -0,0 +1,65 @@
+#ifndef MPLLIBS_METAPARSE_V1_REGEX_MATCHER_HPP
+#define MPLLIBS_METAPARSE_V1_REGEX_MATCHER_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/regex_automaton.hpp>
+#include <mpllibs/metaparse/v1/impl/regex_runtime_state.hpp>
+
+#include <string>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      // Matching strings at runtime using the automaton of the regular
+      // expression R built at compile-time
+      template <class R>
+      struct regex_matcher
+      {
+        typedef regex_matcher type;
+
+        typedef impl::regex_automaton<R> automaton;
+
+        static bool match(const char* begin_, const char* end_)
+        {
+          const impl::regex_runtime_state* s = start();
+          for (; begin_ != end_; ++begin_)
+          {
+            s = s->next[static_cast<unsigned char>(*begin_)];
+          }
+          return s->accepting;
+        }
+
+        static bool match(const char* s_)
+        {
+          const impl::regex_runtime_state* s = start();
+          for (; *s_ != 0; ++s_)
+          {
+            s = s->next[static_cast<unsigned char>(*s_)];
+          }
+          return s->accepting;
+        }
+
+        static bool match(const std::string& s_)
+        {
+          return match(s_.data(), s_.data() + s_.size());
+        }
+      private:
+        static const impl::regex_runtime_state* start()
+        {
+          return
+            &impl::regex_runtime_table<automaton, automaton::start>::value;
+        }
+      };
+    }
+  }
+}
+
+#endif
+
@@ -11,8 +11,6 @@
 
 #include <mpllibs/metamonad/tmp_tag.hpp>
 
-#include <iostream>
-
 namespace mpllibs
 {
   namespace metaparse
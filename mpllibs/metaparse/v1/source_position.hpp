@@ -12,6 +12,7 @@
 #include <mpllibs/boost.hpp>
 
 #include <boost/mpl/bool.hpp>
+#include <boost/mpl/equal_to.hpp>
 
 namespace mpllibs
 {
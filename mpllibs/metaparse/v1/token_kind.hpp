@@ -0,0 +1,70 @@
+#ifndef MPLLIBS_METAPARSE_V1_TOKEN_KIND_HPP
+#define MPLLIBS_METAPARSE_V1_TOKEN_KIND_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/error/unexpected_end_of_input.hpp>
+#include <mpllibs/metaparse/v1/error/unexpected_token.hpp>
+#include <mpllibs/metaparse/v1/fail.hpp>
+#include <mpllibs/metaparse/v1/return_.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/pop_front.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      template <class Kind>
+      struct token_kind
+      {
+      private:
+        template <class S, class Pos>
+        struct accept_token
+        {
+          typedef typename boost::mpl::front<S>::type t;
+
+          typedef
+            typename boost::mpl::eval_if<
+              typename boost::is_same<typename t::kind, Kind>::type,
+              boost::mpl::apply_wrap2<
+                return_<typename t::value>,
+                typename boost::mpl::pop_front<S>::type,
+                typename t::next_position
+              >,
+              boost::mpl::apply_wrap2<fail<error::unexpected_token>, S, Pos>
+            >::type
+            type;
+        };
+      public:
+        typedef token_kind type;
+
+        template <class S, class Pos>
+        struct apply :
+          boost::mpl::eval_if<
+            typename boost::mpl::empty<S>::type,
+            boost::mpl::apply_wrap2<
+              fail<error::unexpected_end_of_input>,
+              S,
+              Pos
+            >,
+            accept_token<S, Pos>
+          >
+        {};
+      };
+    }
+  }
+}
+
+#endif
+
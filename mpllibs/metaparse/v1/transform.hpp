@@ -12,7 +12,6 @@
 #include <mpllibs/metaparse/v1/get_position.hpp>
 #include <mpllibs/metaparse/v1/unless_error.hpp>
 
-#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/apply.hpp>
 #include <boost/mpl/apply_wrap.hpp>
 
@@ -8,7 +8,6 @@
 
 #include <mpllibs/metaparse/v1/is_error.hpp>
 
-#include <boost/mpl/equal_to.hpp>
 #include <boost/mpl/eval_if.hpp>
 
 namespace mpllibs
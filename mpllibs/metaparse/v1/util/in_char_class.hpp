@@ -0,0 +1,67 @@
+#ifndef MPLLIBS_METAPARSE_V1_UTIL_IN_CHAR_CLASS_HPP
+#define MPLLIBS_METAPARSE_V1_UTIL_IN_CHAR_CLASS_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/metaparse/v1/impl/char_class_word.hpp>
+
+#include <boost/mpl/bool.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+namespace mpllibs
+{
+  namespace metaparse
+  {
+    namespace v1
+    {
+      namespace util
+      {
+        template <class Class>
+        struct in_char_class
+        {
+          typedef in_char_class type;
+
+          #ifdef MPLLIBS_CHAR_CLASS_SELECT
+          #  error MPLLIBS_CHAR_CLASS_SELECT already defined
+          #endif
+          #define MPLLIBS_CHAR_CLASS_SELECT(z, n, unused) \
+            code / 32 == n ? Class::BOOST_PP_CAT(word, n) :
+
+          template <class Item>
+          struct apply
+          {
+            static const int code =
+              static_cast<unsigned char>(Item::type::value);
+
+            typedef
+              boost::mpl::bool_<
+                (
+                  (
+                    BOOST_PP_REPEAT(
+                      MPLLIBS_CHAR_CLASS_WORDS,
+                      MPLLIBS_CHAR_CLASS_SELECT,
+                      ~
+                    )
+                    0ul
+                  ) >> (code % 32)
+                ) & 1
+              >
+              type;
+
+            static const bool value = type::value;
+          };
+
+          #undef MPLLIBS_CHAR_CLASS_SELECT
+        };
+      }
+    }
+  }
+}
+
+#endif
+
@@ -8,8 +8,8 @@
 
 #include <mpllibs/metaparse/v1/util/in_range.hpp>
 
+#include <boost/mpl/aux_/na.hpp>
 #include <boost/mpl/char.hpp>
-#include <boost/mpl/vector.hpp>
 
 namespace mpllibs
 {
@@ -8,7 +8,7 @@
 
 #include <mpllibs/metaparse/v1/util/is_whitespace_c.hpp>
 
-#include <boost/mpl/vector.hpp>
+#include <boost/mpl/aux_/na.hpp>
 
 namespace mpllibs
 {
@@ -0,0 +1,20 @@
+#ifndef MPLLIBS_SAFE_PRINTF_BOUNDED_SPRINTF_HPP
+#define MPLLIBS_SAFE_PRINTF_BOUNDED_SPRINTF_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/bounded_sprintf.hpp>
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    using v1::bounded_sprintf;
+  }
+}
+
+#endif
+
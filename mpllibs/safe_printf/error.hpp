@@ -15,6 +15,7 @@ namespace mpllibs
     namespace error
     {
       using v1::error::no_percentage_char_expected;
+      using v1::error::unknown_output_length;
     }
   }
 }
@@ -0,0 +1,44 @@
+#ifndef MPLLIBS_SAFE_PRINTF_V1_BUFFER_HPP
+#define MPLLIBS_SAFE_PRINTF_V1_BUFFER_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/fwd/buffer.hpp>
+#include <mpllibs/safe_printf/v1/max_length.hpp>
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      // A character array the output of FormatString always fits in
+      template <class FormatString>
+      class buffer
+      {
+      public:
+        static const int capacity = max_length<FormatString>::type::value + 1;
+
+        buffer() : _size(0) { _data[0] = 0; }
+
+        char* data() { return _data; }
+        const char* c_str() const { return _data; }
+
+        int size() const { return _size; }
+        void resize(int size_) { _size = size_; }
+      private:
+        char _data[capacity];
+        int _size;
+      };
+
+      template <class FormatString>
+      const int buffer<FormatString>::capacity;
+    }
+  }
+}
+
+#endif
+
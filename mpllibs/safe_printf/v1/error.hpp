@@ -27,6 +27,18 @@ namespace mpllibs
             return "No % char expected";
           }
         };
+
+        struct unknown_output_length
+        {
+          typedef unknown_output_length type;
+
+          static std::string get_value()
+          {
+            return
+              "The length of the output depends on runtime values. Use a"
+              " precision for %s and no * for the width and the precision.";
+          }
+        };
       }
     }
   }
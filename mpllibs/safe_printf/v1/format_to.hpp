@@ -0,0 +1,98 @@
+#ifndef MPLLIBS_SAFE_PRINTF_V1_FORMAT_TO_HPP
+#define MPLLIBS_SAFE_PRINTF_V1_FORMAT_TO_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/fwd/format_to.hpp>
+#include <mpllibs/safe_printf/v1/impl/fallback_length.hpp>
+#include <mpllibs/safe_printf/v1/impl/format_into.hpp>
+#include <mpllibs/safe_printf/v1/valid_arguments.hpp>
+
+#include <mpllibs/metamonad/box.hpp>
+
+#include <boost/mpl/vector.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/comma_if.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/enum_binary_params.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+#include <string>
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      #ifdef MPLLIBS_FORMAT_TO_BOX
+      #  error MPLLIBS_FORMAT_TO_BOX already defined
+      #endif
+      #define MPLLIBS_FORMAT_TO_BOX(z, n, unused) \
+        metamonad::box<BOOST_PP_CAT(T, n)>
+
+      // The arguments are formatted from the table of the format string
+      // built at compile time. The integer, character and string conversions
+      // are written directly after the end of the container. The floating point and pointer
+      // conversions are formatted by snprintf into a buffer on the stack,
+      // which is as long as the longest of them when it is known at compile
+      // time. The last element of args makes the array non-empty.
+      #ifdef MPLLIBS_FORMAT_TO
+      #  error MPLLIBS_FORMAT_TO already defined
+      #endif
+      #define MPLLIBS_FORMAT_TO(z, n, unused) \
+        template < \
+          class FormatString, \
+          class Container \
+          BOOST_PP_COMMA_IF(n) BOOST_PP_ENUM_PARAMS(n, class T) \
+        > \
+        int format_to( \
+          Container& c BOOST_PP_COMMA_IF(n) \
+          BOOST_PP_ENUM_BINARY_PARAMS(n, T, t) \
+        ) \
+        { \
+          BOOST_STATIC_ASSERT(( \
+            valid_arguments< \
+              FormatString, \
+              boost::mpl::vector<BOOST_PP_ENUM(n, MPLLIBS_FORMAT_TO_BOX, ~)> \
+            >::type::value \
+          )); \
+          \
+          const impl::format_arg \
+            args[n + 1] = {BOOST_PP_ENUM_PARAMS(n, t) BOOST_PP_COMMA_IF(n) 0}; \
+          return \
+            impl::format_into< \
+              impl::fallback_length<FormatString>::type::value + 1 \
+            >(c, impl::format_table<FormatString>::value, args); \
+        } \
+        \
+        template < \
+          class FormatString \
+          BOOST_PP_COMMA_IF(n) BOOST_PP_ENUM_PARAMS(n, class T) \
+        > \
+        std::string format(BOOST_PP_ENUM_BINARY_PARAMS(n, T, t)) \
+        { \
+          std::string result; \
+          v1::format_to<FormatString>( \
+            result BOOST_PP_COMMA_IF(n) BOOST_PP_ENUM_PARAMS(n, t) \
+          ); \
+          return result; \
+        }
+  
+      BOOST_PP_REPEAT(MPLLIBS_PRINTF_MAX_ARGUMENT, MPLLIBS_FORMAT_TO, ~)
+  
+      #undef MPLLIBS_FORMAT_TO
+      #undef MPLLIBS_FORMAT_TO_BOX
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,43 @@
+#ifndef MPLLIBS_SAFE_PRINTF_V1_FWD_BOUNDED_SPRINTF_HPP
+#define MPLLIBS_SAFE_PRINTF_V1_FWD_BOUNDED_SPRINTF_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/fwd/buffer.hpp>
+#include <mpllibs/safe_printf/printf_max_argument.hpp>
+
+#include <boost/preprocessor/comma_if.hpp>
+#include <boost/preprocessor/repetition/enum_binary_params.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      #ifdef MPLLIBS_BOUNDED_SPRINTF
+      #  error MPLLIBS_BOUNDED_SPRINTF already defined
+      #endif
+      #define MPLLIBS_BOUNDED_SPRINTF(z, n, unused) \
+        template < \
+          class FormatString \
+          BOOST_PP_COMMA_IF(n) BOOST_PP_ENUM_PARAMS(n, class T) \
+        > \
+        buffer<FormatString> bounded_sprintf( \
+          BOOST_PP_ENUM_BINARY_PARAMS(n, T, t) \
+        );
+  
+      BOOST_PP_REPEAT(MPLLIBS_PRINTF_MAX_ARGUMENT, MPLLIBS_BOUNDED_SPRINTF, ~)
+  
+      #undef MPLLIBS_BOUNDED_SPRINTF
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,22 @@
+#ifndef MPLLIBS_SAFE_PRINTF_V1_FWD_BUFFER_HPP
+#define MPLLIBS_SAFE_PRINTF_V1_FWD_BUFFER_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      template <class FormatString>
+      class buffer;
+    }
+  }
+}
+
+#endif
+
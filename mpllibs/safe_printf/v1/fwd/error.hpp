@@ -15,6 +15,7 @@ namespace mpllibs
       namespace error
       {
         struct no_percentage_char_expected;
+        struct unknown_output_length;
       }
     }
   }
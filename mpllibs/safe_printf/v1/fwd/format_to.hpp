@@ -0,0 +1,52 @@
+#ifndef MPLLIBS_SAFE_PRINTF_V1_FWD_FORMAT_TO_HPP
+#define MPLLIBS_SAFE_PRINTF_V1_FWD_FORMAT_TO_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/printf_max_argument.hpp>
+
+#include <boost/preprocessor/comma_if.hpp>
+#include <boost/preprocessor/repetition/enum_binary_params.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+#include <string>
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      #ifdef MPLLIBS_FORMAT_TO
+      #  error MPLLIBS_FORMAT_TO already defined
+      #endif
+      #define MPLLIBS_FORMAT_TO(z, n, unused) \
+        template < \
+          class FormatString, \
+          class Container \
+          BOOST_PP_COMMA_IF(n) BOOST_PP_ENUM_PARAMS(n, class T) \
+        > \
+        int format_to( \
+          Container& c BOOST_PP_COMMA_IF(n) \
+          BOOST_PP_ENUM_BINARY_PARAMS(n, T, t) \
+        ); \
+        \
+        template < \
+          class FormatString \
+          BOOST_PP_COMMA_IF(n) BOOST_PP_ENUM_PARAMS(n, class T) \
+        > \
+        std::string format(BOOST_PP_ENUM_BINARY_PARAMS(n, T, t));
+  
+      BOOST_PP_REPEAT(MPLLIBS_PRINTF_MAX_ARGUMENT, MPLLIBS_FORMAT_TO, ~)
+  
+      #undef MPLLIBS_FORMAT_TO
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,56 @@
+#ifndef MPLLIBS_SAFE_PRINTF_IMPL_FALLBACK_LENGTH_HPP
+#define MPLLIBS_SAFE_PRINTF_IMPL_FALLBACK_LENGTH_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/impl/length_grammar.hpp>
+
+#include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/start.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/int.hpp>
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The maximum length of the conversions of S format_to leaves to the
+        // C library, when it is known at compile time. It is 0 for invalid
+        // format strings.
+        template <class S>
+        struct fallback_length :
+          boost::mpl::eval_if<
+            typename metaparse::is_error<
+              boost::mpl::apply_wrap2<
+                length_grammar::fallback_length,
+                S,
+                metaparse::start
+              >
+            >::type,
+            boost::mpl::int_<0>,
+            metaparse::get_result<
+              boost::mpl::apply_wrap2<
+                length_grammar::fallback_length,
+                S,
+                metaparse::start
+              >
+            >
+          >
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,516 @@
+#ifndef MPLLIBS_SAFE_PRINTF_IMPL_FORMAT_INTO_HPP
+#define MPLLIBS_SAFE_PRINTF_IMPL_FORMAT_INTO_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/impl/format_table.hpp>
+#include <mpllibs/safe_printf/v1/impl/length_grammar.hpp>
+
+#include <boost/mpl/int.hpp>
+
+#include <climits>
+#include <cstdio>
+#include <cwchar>
+#include <limits>
+
+/*
+ * The runtime part of format_to. It walks the table of the format string built
+ * at compile time, the format string itself is not parsed at runtime. The
+ * integer, character and string
+ * conversions are written directly into the container, the floating point
+ * and pointer conversions are formatted by the C library into a buffer on the
+ * stack, the length of which is calculated at compile time.
+ */
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // The format string has already been checked against the types of
+        // the arguments, the conversion specifications tell which member of
+        // value is used.
+        struct format_arg
+        {
+          union
+          {
+            long i;
+            unsigned long u;
+            long double f;
+            const void* p;
+          } value;
+
+          format_arg(char v_) { value.i = v_; }
+          format_arg(wchar_t v_) { value.i = v_; }
+          format_arg(short v_) { value.i = v_; }
+          format_arg(int v_) { value.i = v_; }
+          format_arg(long v_) { value.i = v_; }
+          format_arg(unsigned short v_) { value.u = v_; }
+          format_arg(unsigned int v_) { value.u = v_; }
+          format_arg(unsigned long v_) { value.u = v_; }
+          format_arg(double v_) { value.f = v_; }
+          format_arg(long double v_) { value.f = v_; }
+
+          template <class T>
+          format_arg(T* v_) { value.p = v_; }
+        };
+
+        template <class Container>
+        void format_append(Container& c_, const char* begin_, const char* end_)
+        {
+          c_.insert(c_.end(), begin_, end_);
+        }
+
+        template <class Container>
+        void format_fill(Container& c_, int n_, char fill_)
+        {
+          if (n_ > 0)
+          {
+            c_.insert(c_.end(), typename Container::size_type(n_), fill_);
+          }
+        }
+
+        // prefix_ is the sign or the 0x prefix of the number
+        template <class Container>
+        void format_integer(
+          Container& c_,
+          const format_spec& s_,
+          unsigned long n_,
+          const char* prefix_,
+          unsigned int base_,
+          bool upper_case_
+        )
+        {
+          const char* digit_chars =
+            upper_case_ ? "0123456789ABCDEF" : "0123456789abcdef";
+
+          char digits[sizeof(unsigned long) * CHAR_BIT];
+          char* const end = digits + sizeof(digits);
+          char* begin = end;
+          for (; n_ != 0; n_ /= base_)
+          {
+            *--begin = digit_chars[n_ % base_];
+          }
+
+          const int len = int(end - begin);
+          int prefix_len = 0;
+          while (prefix_[prefix_len] != 0)
+          {
+            ++prefix_len;
+          }
+
+          const int precision = s_.precision < 0 ? 1 : s_.precision;
+          int zeros = precision < len ? 0 : precision - len;
+          if (s_.alternate && base_ == 8 && zeros == 0)
+          {
+            zeros = 1;
+          }
+          if (
+            !s_.left && s_.zero && s_.precision < 0
+            && s_.width > prefix_len + zeros + len
+          )
+          {
+            zeros = s_.width - prefix_len - len;
+          }
+          const int padding = s_.width - prefix_len - zeros - len;
+
+          if (!s_.left)
+          {
+            format_fill(c_, padding, ' ');
+          }
+          format_append(c_, prefix_, prefix_ + prefix_len);
+          format_fill(c_, zeros, '0');
+          format_append(c_, begin, end);
+          if (s_.left)
+          {
+            format_fill(c_, padding, ' ');
+          }
+        }
+
+        template <class Container>
+        void format_signed(Container& c_, const format_spec& s_, long n_)
+        {
+          if (n_ < 0)
+          {
+            format_integer(
+              c_,
+              s_,
+              0ul - static_cast<unsigned long>(n_),
+              "-",
+              10,
+              false
+            );
+          }
+          else
+          {
+            format_integer(
+              c_,
+              s_,
+              n_,
+              s_.sign ? "+" : (s_.space ? " " : ""),
+              10,
+              false
+            );
+          }
+        }
+
+        template <class Container>
+        void format_unsigned(
+          Container& c_,
+          const format_spec& s_,
+          unsigned long n_
+        )
+        {
+          switch (s_.conversion)
+          {
+          case 'o':
+            format_integer(c_, s_, n_, "", 8, false);
+            break;
+          case 'x':
+            format_integer(
+              c_,
+              s_,
+              n_,
+              s_.alternate && n_ != 0 ? "0x" : "",
+              16,
+              false
+            );
+            break;
+          case 'X':
+            format_integer(
+              c_,
+              s_,
+              n_,
+              s_.alternate && n_ != 0 ? "0X" : "",
+              16,
+              true
+            );
+            break;
+          default:
+            format_integer(c_, s_, n_, "", 10, false);
+          }
+        }
+
+        // Writes len_ characters with the padding of s_
+        template <class Container>
+        void format_text(
+          Container& c_,
+          const format_spec& s_,
+          const char* text_,
+          int len_
+        )
+        {
+          if (!s_.left)
+          {
+            format_fill(c_, s_.width - len_, ' ');
+          }
+          format_append(c_, text_, text_ + len_);
+          if (s_.left)
+          {
+            format_fill(c_, s_.width - len_, ' ');
+          }
+        }
+
+        template <class Container>
+        void format_string(
+          Container& c_,
+          const format_spec& s_,
+          const char* str_
+        )
+        {
+          int len = 0;
+          while ((s_.precision < 0 || len < s_.precision) && str_[len] != 0)
+          {
+            ++len;
+          }
+          format_text(c_, s_, str_, len);
+        }
+
+        // Returns false when a character can not be converted
+        template <class Container>
+        bool format_wide_string(
+          Container& c_,
+          const format_spec& s_,
+          const wchar_t* str_
+        )
+        {
+          const typename Container::size_type begin = c_.size();
+          std::mbstate_t state = std::mbstate_t();
+          char mb[MB_LEN_MAX];
+          int len = 0;
+          for (; *str_ != 0; ++str_)
+          {
+            const std::size_t n = std::wcrtomb(mb, *str_, &state);
+            if (n == std::size_t(-1))
+            {
+              return false;
+            }
+            else if (s_.precision >= 0 && len + int(n) > s_.precision)
+            {
+              break;
+            }
+            format_append(c_, mb, mb + n);
+            len += int(n);
+          }
+
+          if (s_.width > len)
+          {
+            if (s_.left)
+            {
+              format_fill(c_, s_.width - len, ' ');
+            }
+            else
+            {
+              c_.insert(
+                c_.begin() + begin,
+                typename Container::size_type(s_.width - len),
+                ' '
+              );
+            }
+          }
+          return true;
+        }
+
+        // The maximum length of the conversions format_to leaves to the C
+        // library with a precision known at runtime
+        template <class T>
+        int fallback_conversion_length(char conversion_, int precision_)
+        {
+          using length_grammar::exponent_digits;
+
+          const int p = precision_ < 0 ? 6 : precision_;
+          const int g = precision_ == 0 ? 1 : p;
+          const int fixed = g + 6;
+          const int exponent = g + 4 + exponent_digits<T>::type::value;
+          switch (conversion_)
+          {
+          case 'e':
+          case 'E':
+            return p + 5 + exponent_digits<T>::type::value;
+          case 'f':
+            return p + std::numeric_limits<T>::max_exponent10 + 3;
+          case 'g':
+          case 'G':
+            return fixed < exponent ? exponent : fixed;
+          default:
+            return
+              length_grammar::pointer_length::apply<
+                boost::mpl::int_<-1>
+              >::type::value;
+          }
+        }
+
+        // The conversions are formatted into a buffer of BufferLength
+        // characters. When the width or the precision is given by an
+        // argument and the output may not fit into the buffer, the C library
+        // writes it into the container directly.
+        template <int BufferLength, class Container, class T>
+        int format_fallback(Container& c_, const format_spec& s_, T v_)
+        {
+          char format[12] = "%";
+          char* f = format + 1;
+          if (s_.left) { *f++ = '-'; }
+          if (s_.sign) { *f++ = '+'; }
+          if (s_.space) { *f++ = ' '; }
+          if (s_.alternate) { *f++ = '#'; }
+          if (s_.zero) { *f++ = '0'; }
+          *f++ = '*';
+          *f++ = '.';
+          *f++ = '*';
+          if (s_.length == 'L') { *f++ = 'L'; }
+          *f++ = s_.conversion;
+          *f = 0;
+
+          const int len =
+            fallback_conversion_length<T>(s_.conversion, s_.precision);
+          const int max_len = len < s_.width ? s_.width : len;
+          if (len < 0 || max_len == INT_MAX)
+          {
+            return -1;
+          }
+          else if (max_len < BufferLength)
+          {
+            char buf[BufferLength];
+            const int n =
+              ::snprintf(buf, BufferLength, format, s_.width, s_.precision, v_);
+            if (n >= 0)
+            {
+              format_append(c_, buf, buf + n);
+            }
+            return n;
+          }
+          else
+          {
+            const typename Container::size_type old_size = c_.size();
+            c_.resize(old_size + max_len + 1);
+            const int n =
+              ::snprintf(
+                &c_[old_size],
+                max_len + 1,
+                format,
+                s_.width,
+                s_.precision,
+                v_
+              );
+            c_.resize(n < 0 ? old_size : old_size + n);
+            return n;
+          }
+        }
+
+        // written_ is the number of characters written by the format string
+        // so far. Returns false on error.
+        template <int BufferLength, class Container>
+        bool format_conversion(
+          Container& c_,
+          const format_spec& s_,
+          const format_arg& a_,
+          int written_
+        )
+        {
+          switch (s_.conversion)
+          {
+          case 'd':
+          case 'i':
+            format_signed(c_, s_, a_.value.i);
+            return true;
+          case 'o':
+            // The signed argument is taken as unsigned
+            format_unsigned(
+              c_,
+              s_,
+              s_.length == 'h' ?
+                static_cast<unsigned short>(a_.value.i) :
+                (
+                  s_.length == 'l' ?
+                    static_cast<unsigned long>(a_.value.i) :
+                    static_cast<unsigned int>(a_.value.i)
+                )
+            );
+            return true;
+          case 'u':
+          case 'x':
+          case 'X':
+            format_unsigned(c_, s_, a_.value.u);
+            return true;
+          case 'c':
+            if (s_.length == 'l')
+            {
+              std::mbstate_t state = std::mbstate_t();
+              char mb[MB_LEN_MAX];
+              const std::size_t
+                n = std::wcrtomb(mb, wchar_t(a_.value.i), &state);
+              if (n == std::size_t(-1))
+              {
+                return false;
+              }
+              format_text(c_, s_, mb, int(n));
+            }
+            else
+            {
+              const char c = char(a_.value.i);
+              format_text(c_, s_, &c, 1);
+            }
+            return true;
+          case 's':
+            if (s_.length == 'l')
+            {
+              return
+                format_wide_string(
+                  c_,
+                  s_,
+                  static_cast<const wchar_t*>(a_.value.p)
+                );
+            }
+            else
+            {
+              format_string(c_, s_, static_cast<const char*>(a_.value.p));
+              return true;
+            }
+          case 'n':
+            *static_cast<int*>(const_cast<void*>(a_.value.p)) = written_;
+            return true;
+          case 'p':
+            return
+              format_fallback<BufferLength>(
+                c_,
+                s_,
+                const_cast<void*>(a_.value.p)
+              ) >= 0;
+          default:
+            return
+              (
+                s_.length == 'L' ?
+                  format_fallback<BufferLength>(c_, s_, a_.value.f) :
+                  format_fallback<BufferLength>(c_, s_, double(a_.value.f))
+              ) >= 0;
+          }
+        }
+
+        // Appends the output of the format string table_ was built from to
+        // c_. Returns the number of characters appended or -1 on error, in
+        // which case c_ is left unchanged.
+        template <int BufferLength, class Container>
+        int format_into(
+          Container& c_,
+          const format_element* table_,
+          const format_arg* a_
+        )
+        {
+          const typename Container::size_type old_size = c_.size();
+          for (;; ++table_)
+          {
+            format_append(
+              c_,
+              table_->text,
+              table_->text + table_->text_length
+            );
+
+            if (table_->spec.conversion == 0)
+            {
+              return int(c_.size() - old_size);
+            }
+
+            format_spec s = table_->spec;
+            if (s.width == format_spec::from_argument)
+            {
+              s.width = int((a_++)->value.i);
+              if (s.width < 0)
+              {
+                s.left = true;
+                s.width = -s.width;
+              }
+            }
+            if (s.precision == format_spec::from_argument)
+            {
+              // A negative precision is taken as if it was omitted
+              const int p = int((a_++)->value.i);
+              s.precision = p < 0 ? -1 : p;
+            }
+
+            if (
+              !format_conversion<BufferLength>(
+                c_,
+                s,
+                *a_++,
+                int(c_.size() - old_size)
+              )
+            )
+            {
+              c_.resize(old_size);
+              return -1;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,378 @@
+#ifndef MPLLIBS_SAFE_PRINTF_IMPL_FORMAT_TABLE_HPP
+#define MPLLIBS_SAFE_PRINTF_IMPL_FORMAT_TABLE_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/impl/grammar.hpp>
+#include <mpllibs/safe_printf/v1/error.hpp>
+#include <mpllibs/safe_printf/printf_max_argument.hpp>
+
+#include <mpllibs/metaparse/entire_input.hpp>
+#include <mpllibs/metaparse/foldlp.hpp>
+#include <mpllibs/metaparse/get_result.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+#include <mpllibs/metaparse/is_error.hpp>
+#include <mpllibs/metaparse/start.hpp>
+#include <mpllibs/metaparse/string.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/char.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/pair.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
+
+/*
+ * The table format_to formats the arguments from. It is built from the format
+ * string at compile time: every element of it is the literal text before a
+ * conversion and the conversion specification. The last element is the text
+ * after the last conversion, its conversion is 0.
+ */
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        // precision is -1 when the conversion has no precision. width and
+        // precision are from_argument when they are given by an argument (*)
+        struct format_spec
+        {
+          static const int from_argument = -2;
+
+          bool left;
+          bool sign;
+          bool space;
+          bool alternate;
+          bool zero;
+          int width;
+          int precision;
+          char length;
+          char conversion;
+        };
+
+        struct format_element
+        {
+          const char* text;
+          int text_length;
+          format_spec spec;
+        };
+
+        namespace table_grammar
+        {
+          using mpllibs::metaparse::always_c;
+          using mpllibs::metaparse::any;
+          using mpllibs::metaparse::entire_input;
+          using mpllibs::metaparse::foldlp;
+          using mpllibs::metaparse::last_of;
+          using mpllibs::metaparse::lit_c;
+          using mpllibs::metaparse::one_char;
+          using mpllibs::metaparse::one_of;
+          using mpllibs::metaparse::one_of_c;
+          using mpllibs::metaparse::return_;
+          using mpllibs::metaparse::sequence;
+          using mpllibs::metaparse::transform;
+
+          using grammar::flag;
+          using grammar::normal_chars;
+
+          template <char C>
+          struct is_flag
+          {
+            typedef is_flag type;
+
+            template <class Found, class Flag>
+            struct apply :
+              boost::mpl::bool_<
+                Found::type::value || Flag::type::value == C
+              >
+            {};
+          };
+
+          template <class Flags, char C>
+          struct has_flag :
+            boost::mpl::fold<Flags, boost::mpl::false_, is_flag<C> >::type
+          {};
+
+          // Width and Precision are int_ values, Length and Conversion are
+          // char_ values
+          template <
+            class Flags,
+            class Width,
+            class Precision,
+            class Length,
+            class Conversion
+          >
+          struct spec
+          {
+            typedef spec type;
+
+            typedef has_flag<Flags, '-'> left;
+            typedef has_flag<Flags, '+'> sign;
+            typedef has_flag<Flags, ' '> space;
+            typedef has_flag<Flags, '#'> alternate;
+            typedef has_flag<Flags, '0'> zero;
+            typedef Width width;
+            typedef Precision precision;
+            typedef Length length;
+            typedef Conversion conversion;
+          };
+
+          typedef
+            spec<
+              boost::mpl::vector<>,
+              boost::mpl::int_<0>,
+              boost::mpl::int_<-1>,
+              boost::mpl::char_<0>,
+              boost::mpl::char_<0>
+            >
+            end_spec;
+
+          struct append_char
+          {
+            typedef append_char type;
+
+            template <class Text, class C>
+            struct apply : boost::mpl::push_back<Text, C> {};
+          };
+
+          // Chars is the sequence of characters normal_chars returns
+          template <class Chars, class Spec>
+          struct element
+          {
+            typedef element type;
+
+            typedef
+              typename boost::mpl::fold<
+                Chars,
+                metaparse::string<>,
+                append_char
+              >::type
+              text;
+
+            typedef Spec spec;
+          };
+
+          typedef
+            one_of<
+              mpllibs::metaparse::int_,
+              always_c<'*', boost::mpl::int_<format_spec::from_argument> >,
+              return_<boost::mpl::int_<0> >
+            >
+            width;
+
+          typedef
+            one_of<
+              last_of<lit_c<'.'>, width>,
+              return_<boost::mpl::int_<-1> >
+            >
+            precision;
+
+          // Returns the length modifier (0 when there is none) and the
+          // conversion
+          typedef
+            sequence<
+              one_of<one_of_c<'h', 'l', 'L'>, return_<boost::mpl::char_<0> > >,
+              one_char
+            >
+            conversion;
+
+          struct make_spec
+          {
+            typedef make_spec type;
+
+            template <class Parameter>
+            struct apply :
+              spec<
+                typename boost::mpl::at_c<Parameter, 0>::type,
+                typename boost::mpl::at_c<Parameter, 1>::type,
+                typename boost::mpl::at_c<Parameter, 2>::type,
+                typename boost::mpl::at_c<
+                  typename boost::mpl::at_c<Parameter, 3>::type,
+                  0
+                >::type,
+                typename boost::mpl::at_c<
+                  typename boost::mpl::at_c<Parameter, 3>::type,
+                  1
+                >::type
+              >
+            {};
+          };
+
+          // The conversions have already been checked by valid_arguments
+          typedef
+            last_of<
+              lit_c<'%'>,
+              transform<
+                sequence<any<flag>, width, precision, conversion>,
+                make_spec
+              >
+            >
+            parameter;
+
+          // The state of the fold is the elements built so far and the text
+          // waiting for the next conversion
+          struct start_table
+          {
+            typedef start_table type;
+
+            template <class Chars>
+            struct apply : boost::mpl::pair<boost::mpl::vector<>, Chars> {};
+          };
+
+          struct add_element
+          {
+            typedef add_element type;
+
+            template <class Element, class State>
+            struct apply :
+              boost::mpl::pair<
+                typename boost::mpl::push_back<
+                  typename State::first,
+                  element<
+                    typename State::second,
+                    typename boost::mpl::at_c<Element, 0>::type
+                  >
+                >::type,
+                typename boost::mpl::at_c<Element, 1>::type
+              >
+            {};
+          };
+
+          struct finish_table
+          {
+            typedef finish_table type;
+
+            template <class State>
+            struct apply :
+              boost::mpl::push_back<
+                typename State::first,
+                element<typename State::second, end_spec>
+              >
+            {};
+          };
+
+          // Returns the vector of elements
+          typedef
+            transform<
+              entire_input<
+                foldlp<
+                  sequence<parameter, normal_chars>,
+                  transform<normal_chars, start_table>,
+                  add_element
+                >,
+                error::no_percentage_char_expected
+              >,
+              finish_table
+            >
+            table;
+        }
+
+        // The elements of the table of S. It is empty for invalid format
+        // strings.
+        template <class S>
+        struct format_elements :
+          boost::mpl::eval_if<
+            typename metaparse::is_error<
+              boost::mpl::apply_wrap2<table_grammar::table, S, metaparse::start>
+            >::type,
+            boost::mpl::vector<
+              table_grammar::element<
+                boost::mpl::vector<>,
+                table_grammar::end_spec
+              >
+            >,
+            metaparse::get_result<
+              boost::mpl::apply_wrap2<table_grammar::table, S, metaparse::start>
+            >
+          >
+        {};
+
+        template <
+          class Elements,
+          int Size = boost::mpl::size<Elements>::type::value
+        >
+        struct format_table_impl;
+
+        #ifdef MPLLIBS_FORMAT_ELEMENT
+        #  error MPLLIBS_FORMAT_ELEMENT already defined
+        #endif
+        #define MPLLIBS_FORMAT_ELEMENT(z, n, unused) \
+          { \
+            boost::mpl::c_str< \
+              typename boost::mpl::at_c<Elements, n>::type::text \
+            >::type::value, \
+            boost::mpl::size< \
+              typename boost::mpl::at_c<Elements, n>::type::text \
+            >::type::value, \
+            { \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, left), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, sign), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, space), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, alternate), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, zero), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, width), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, precision), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, length), \
+              MPLLIBS_FORMAT_SPEC_FIELD(n, conversion) \
+            } \
+          }
+
+        #ifdef MPLLIBS_FORMAT_SPEC_FIELD
+        #  error MPLLIBS_FORMAT_SPEC_FIELD already defined
+        #endif
+        #define MPLLIBS_FORMAT_SPEC_FIELD(n, name) \
+          boost::mpl::at_c<Elements, n>::type::spec::name::type::value
+
+        #ifdef MPLLIBS_FORMAT_TABLE
+        #  error MPLLIBS_FORMAT_TABLE already defined
+        #endif
+        #define MPLLIBS_FORMAT_TABLE(z, n, unused) \
+          template <class Elements> \
+          struct format_table_impl<Elements, n> \
+          { \
+            static const format_element value[n]; \
+          }; \
+          \
+          template <class Elements> \
+          const format_element format_table_impl<Elements, n>::value[n] = \
+            {BOOST_PP_ENUM(n, MPLLIBS_FORMAT_ELEMENT, ~)};
+
+        // A format string of n arguments has at most n conversions
+        BOOST_PP_REPEAT_FROM_TO(
+          1,
+          BOOST_PP_INC(MPLLIBS_PRINTF_MAX_ARGUMENT),
+          MPLLIBS_FORMAT_TABLE,
+          ~
+        )
+
+        #undef MPLLIBS_FORMAT_TABLE
+        #undef MPLLIBS_FORMAT_SPEC_FIELD
+        #undef MPLLIBS_FORMAT_ELEMENT
+
+        template <class S>
+        struct format_table :
+          format_table_impl<typename format_elements<S>::type>
+        {};
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,482 @@
+#ifndef MPLLIBS_SAFE_PRINTF_IMPL_LENGTH_GRAMMAR_HPP
+#define MPLLIBS_SAFE_PRINTF_IMPL_LENGTH_GRAMMAR_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/impl/grammar.hpp>
+#include <mpllibs/safe_printf/v1/error.hpp>
+
+#include <mpllibs/metaparse/accept_when.hpp>
+#include <mpllibs/metaparse/entire_input.hpp>
+#include <mpllibs/metaparse/foldlp.hpp>
+#include <mpllibs/metaparse/int_.hpp>
+
+#include <boost/mpl/apply_wrap.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/quote.hpp>
+#include <boost/mpl/size.hpp>
+
+#include <climits>
+#include <limits>
+
+/*
+ * The grammar of format strings computing the maximum length of the output.
+ * The result of every parser is an int_ or unbounded, which represents an
+ * output that depends on the values of the arguments, not only on their types.
+ */
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      namespace impl
+      {
+        namespace length_grammar
+        {
+          using mpllibs::metaparse::accept_when;
+          using mpllibs::metaparse::always;
+          using mpllibs::metaparse::always_c;
+          using mpllibs::metaparse::any;
+          using mpllibs::metaparse::entire_input;
+          using mpllibs::metaparse::foldlp;
+          using mpllibs::metaparse::last_of;
+          using mpllibs::metaparse::lit_c;
+          using mpllibs::metaparse::one_of;
+          using mpllibs::metaparse::one_of_c;
+          using mpllibs::metaparse::return_;
+          using mpllibs::metaparse::sequence;
+          using mpllibs::metaparse::transform;
+
+          using grammar::flag;
+          using grammar::normal_chars;
+
+          struct unbounded
+          {
+            typedef unbounded type;
+          };
+
+          template <class A, class B>
+          struct add_length :
+            boost::mpl::int_<A::type::value + B::type::value>
+          {};
+
+          template <class B>
+          struct add_length<unbounded, B> : unbounded {};
+
+          template <class A>
+          struct add_length<A, unbounded> : unbounded {};
+
+          template <>
+          struct add_length<unbounded, unbounded> : unbounded {};
+
+          template <class A, class B>
+          struct longest :
+            boost::mpl::int_<
+              (A::type::value < B::type::value) ?
+                B::type::value :
+                A::type::value
+            >
+          {};
+
+          template <class B>
+          struct longest<unbounded, B> : unbounded {};
+
+          template <class A>
+          struct longest<A, unbounded> : unbounded {};
+
+          template <>
+          struct longest<unbounded, unbounded> : unbounded {};
+
+          template <class L>
+          struct is_bounded : boost::mpl::true_ {};
+
+          template <>
+          struct is_bounded<unbounded> : boost::mpl::false_ {};
+
+          // The number of decimal digits of N (N > 0)
+          template <int N, bool OneDigit = (N < 10)>
+          struct decimal_digits :
+            boost::mpl::int_<1 + decimal_digits<N / 10>::type::value>
+          {};
+
+          template <int N>
+          struct decimal_digits<N, true> : boost::mpl::int_<1> {};
+
+          // Precision is -1 when the format string specifies no precision
+
+          // Digits digits at least Precision wide and Extra characters for
+          // the sign or the prefix of the number
+          template <int Digits, int Extra>
+          struct integer_length
+          {
+            typedef integer_length type;
+
+            template <class Precision>
+            struct apply :
+              boost::mpl::int_<
+                (
+                  (Precision::type::value < Digits) ?
+                    Digits :
+                    Precision::type::value
+                ) + Extra
+              >
+            {};
+          };
+
+          template <class T>
+          struct signed_decimal :
+            integer_length<std::numeric_limits<T>::digits10 + 1, 1>
+          {};
+
+          template <class T>
+          struct unsigned_decimal :
+            integer_length<std::numeric_limits<T>::digits10 + 1, 0>
+          {};
+
+          // The extra character is the leading 0 of the # flag
+          template <class T>
+          struct octal : integer_length<(sizeof(T) * CHAR_BIT + 2) / 3, 1> {};
+
+          // The extra characters are the 0x prefix of the # flag
+          template <class T>
+          struct hexadecimal :
+            integer_length<(sizeof(T) * CHAR_BIT + 3) / 4, 2>
+          {};
+
+          template <class Precision, int Default>
+          struct precision_or :
+            boost::mpl::int_<
+              (Precision::type::value < 0) ? Default : Precision::type::value
+            >
+          {};
+
+          template <class T>
+          struct exponent_digits :
+            boost::mpl::int_<
+              (
+                decimal_digits<
+                  std::numeric_limits<T>::max_exponent10
+                >::type::value < 2
+              ) ?
+                2 :
+                decimal_digits<
+                  std::numeric_limits<T>::max_exponent10
+                >::type::value
+            >
+          {};
+
+          // -d.ddde+xx
+          template <class T>
+          struct exponent_length
+          {
+            typedef exponent_length type;
+
+            template <class Precision>
+            struct apply :
+              boost::mpl::int_<
+                precision_or<Precision, 6>::type::value
+                + 5
+                + exponent_digits<T>::type::value
+              >
+            {};
+          };
+
+          // -ddd.ddd
+          template <class T>
+          struct fixed_length
+          {
+            typedef fixed_length type;
+
+            template <class Precision>
+            struct apply :
+              boost::mpl::int_<
+                precision_or<Precision, 6>::type::value
+                + std::numeric_limits<T>::max_exponent10
+                + 3
+              >
+            {};
+          };
+
+          // %g uses 6 digits by default and 1 digit when the precision is 0
+          template <class Precision>
+          struct general_precision :
+            boost::mpl::int_<
+              (Precision::type::value < 0) ?
+                6 :
+                (Precision::type::value == 0 ? 1 : Precision::type::value)
+            >
+          {};
+
+          // The fixed notation is used for exponents from -4 to the
+          // precision, it has the digits of the precision, a sign, a decimal
+          // point and 4 leading zeroes. The exponent notation has one digit
+          // before the decimal point.
+          template <class T>
+          struct general_length
+          {
+            typedef general_length type;
+
+            template <class Precision>
+            struct apply :
+              longest<
+                boost::mpl::int_<general_precision<Precision>::type::value + 6>,
+                boost::mpl::int_<
+                  general_precision<Precision>::type::value
+                  + 4
+                  + exponent_digits<T>::type::value
+                >
+              >
+            {};
+          };
+
+          template <int N>
+          struct fixed_length_c
+          {
+            typedef fixed_length_c type;
+
+            template <class Precision>
+            struct apply : boost::mpl::int_<N> {};
+          };
+
+          // Strings are bounded by their precision only
+          struct string_length
+          {
+            typedef string_length type;
+
+            template <class Precision>
+            struct apply :
+              boost::mpl::if_<
+                boost::mpl::bool_<(Precision::type::value < 0)>,
+                unbounded,
+                Precision
+              >::type
+            {};
+          };
+
+          typedef
+            fixed_length_c<
+              (2 + 2 * sizeof(void*) < 5) ? 5 : 2 + 2 * sizeof(void*)
+            >
+            pointer_length;
+
+          // Returns int_ or unbounded
+          typedef
+            one_of<
+              mpllibs::metaparse::int_,
+              always_c<'*', unbounded>,
+              return_<boost::mpl::int_<0> >
+            >
+            width;
+
+          // Returns int_ or unbounded, int_<-1> when there is no precision
+          typedef
+            one_of<last_of<lit_c<'.'>, width>, return_<boost::mpl::int_<-1> > >
+            precision;
+
+          // The formats return metafunction classes taking the precision
+          typedef
+            one_of<
+              always_c<'c', fixed_length_c<1> >,
+              always<one_of_c<'d', 'i'>, signed_decimal<int> >,
+              always<one_of_c<'e', 'E'>, exponent_length<double> >,
+              always_c<'f', fixed_length<double> >,
+              always<one_of_c<'g', 'G'>, general_length<double> >,
+              always_c<'o', octal<unsigned int> >,
+              always_c<'s', string_length>,
+              always_c<'u', unsigned_decimal<unsigned int> >,
+              always<one_of_c<'x', 'X'>, hexadecimal<unsigned int> >,
+              always_c<'p', pointer_length>,
+              always_c<'n', fixed_length_c<0> >
+            >
+            format_no_flag;
+
+          typedef
+            one_of<
+              always<one_of_c<'d', 'i'>, signed_decimal<short int> >,
+              always_c<'o', octal<short unsigned int> >,
+              always_c<'u', unsigned_decimal<short unsigned int> >,
+              always<one_of_c<'x', 'X'>, hexadecimal<short unsigned int> >
+            >
+            format_h_flag;
+
+          typedef
+            one_of<
+              always_c<'c', fixed_length_c<MB_LEN_MAX> >,
+              always<one_of_c<'d', 'i'>, signed_decimal<long int> >,
+              always_c<'o', octal<long unsigned int> >,
+              always_c<'s', string_length>,
+              always_c<'u', unsigned_decimal<long unsigned int> >,
+              always<one_of_c<'x', 'X'>, hexadecimal<long unsigned int> >
+            >
+            format_l_flag;
+
+          typedef
+            one_of<
+              always<one_of_c<'e', 'E'>, exponent_length<long double> >,
+              always_c<'f', fixed_length<long double> >,
+              always<one_of_c<'g', 'G'>, general_length<long double> >
+            >
+            format_capital_l_flag;
+
+          typedef
+            one_of<
+              last_of<lit_c<'h'>, format_h_flag>,
+              last_of<lit_c<'l'>, format_l_flag>,
+              last_of<lit_c<'L'>, format_capital_l_flag>,
+              format_no_flag
+            >
+            format;
+
+          template <class Width, class Precision, class Format>
+          struct parameter_length_impl :
+            longest<
+              Width,
+              typename boost::mpl::apply_wrap1<Format, Precision>::type
+            >
+          {};
+
+          template <class Width, class Format>
+          struct parameter_length_impl<Width, unbounded, Format> : unbounded {};
+
+          struct parameter_length
+          {
+            typedef parameter_length type;
+
+            template <class Parameter>
+            struct apply :
+              parameter_length_impl<
+                typename boost::mpl::at_c<Parameter, 0>::type,
+                typename boost::mpl::at_c<Parameter, 1>::type,
+                typename boost::mpl::at_c<Parameter, 2>::type
+              >
+            {};
+          };
+
+          typedef
+            last_of<
+              lit_c<'%'>,
+              any<flag>,
+              transform<sequence<width, precision, format>, parameter_length>
+            >
+            parameter;
+
+          struct count_chars
+          {
+            typedef count_chars type;
+
+            template <class Chars>
+            struct apply : boost::mpl::int_<boost::mpl::size<Chars>::value> {};
+          };
+
+          typedef transform<normal_chars, count_chars> normal_length;
+
+          struct add_element
+          {
+            typedef add_element type;
+
+            template <class Element, class Length>
+            struct apply :
+              add_length<
+                typename add_length<
+                  Length,
+                  typename boost::mpl::at_c<Element, 0>::type
+                >::type,
+                typename boost::mpl::at_c<Element, 1>::type
+              >
+            {};
+          };
+
+          // Returns int_ or unbounded
+          typedef
+            entire_input<
+              foldlp<
+                sequence<parameter, normal_length>,
+                normal_length,
+                add_element
+              >,
+              error::no_percentage_char_expected
+            >
+            output_length;
+
+          typedef
+            accept_when<
+              output_length,
+              boost::mpl::quote1<is_bounded>,
+              error::unknown_output_length
+            >
+            S;
+
+          // format_to leaves the floating point and pointer conversions to
+          // the C library, the rest of the conversions give 0
+          typedef
+            one_of<
+              last_of<lit_c<'L'>, format_capital_l_flag>,
+              always<one_of_c<'e', 'E'>, exponent_length<double> >,
+              always_c<'f', fixed_length<double> >,
+              always<one_of_c<'g', 'G'>, general_length<double> >,
+              always_c<'p', pointer_length>,
+              always<format, fixed_length_c<0> >
+            >
+            fallback_format;
+
+          typedef
+            last_of<
+              lit_c<'%'>,
+              any<flag>,
+              transform<
+                sequence<width, precision, fallback_format>,
+                parameter_length
+              >
+            >
+            fallback_parameter;
+
+          // The length of conversions using * is known at runtime only
+          template <class L>
+          struct known_length : L {};
+
+          template <>
+          struct known_length<unbounded> : boost::mpl::int_<0> {};
+
+          struct longest_known
+          {
+            typedef longest_known type;
+
+            template <class Element, class Length>
+            struct apply :
+              longest<
+                Length,
+                typename known_length<
+                  typename boost::mpl::at_c<Element, 0>::type
+                >::type
+              >
+            {};
+          };
+
+          // Returns the int_ of the longest conversion format_to leaves to
+          // the C library
+          typedef
+            entire_input<
+              foldlp<
+                sequence<fallback_parameter, normal_chars>,
+                always<normal_chars, boost::mpl::int_<0> >,
+                longest_known
+              >,
+              error::no_percentage_char_expected
+            >
+            fallback_length;
+        }
+      }
+    }
+  }
+}
+
+#endif
+
@@ -0,0 +1,27 @@
+#ifndef MPLLIBS_SAFE_PRINTF_V1_MAX_LENGTH_HPP
+#define MPLLIBS_SAFE_PRINTF_V1_MAX_LENGTH_HPP
+
+// Copyright Abel Sinkovics (abel@sinkovics.hu)  2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <mpllibs/safe_printf/v1/fwd/max_length.hpp>
+#include <mpllibs/safe_printf/v1/impl/length_parser.hpp>
+
+#include <mpllibs/metamonad/metafunction.hpp>
+
+namespace mpllibs
+{
+  namespace safe_printf
+  {
+    namespace v1
+    {
+      MPLLIBS_METAFUNCTION(max_length, (S))
+      ((impl::length_parser::apply<S>));
+    }
+  }
+}
+
+#endif
+